@@ -0,0 +1,43 @@
+/*
+ * Font_Digits16.c
+ *
+ * Created: 19-Oct-26
+ *  Author: diaag
+ *
+ * Seven segment style numeric font, 10x16 digits, 2 px strokes, 1 column spacing. Codes 0x20..0x39
+ * with glyphs for ' ', '%', '-', '.' and '0'..'9'; the other codes of the
+ * range are missing. Column-RLE coded: 181 bytes (280 raw).
+ */ 
+
+#include <stdint.h>
+#include <avr/pgmspace.h>
+
+#include "Fonts.h"
+
+static const uint8_t Font_Digits16_Data[] PROGMEM = {
+	0x0A, 0x93, 0x00,	// ' '
+	0x0A, 0x13, 0x07, 0x05, 0x07, 0x00, 0x00, 0xC0, 0x30, 0x08, 0x06, 0x01, 0x40, 0x30, 0x08, 0x06, 0x01, 0x00, 0x00, 0x70, 0x50, 0x70,	// '%'
+	0x0A, 0x00, 0x00, 0x87, 0xC0, 0x8A, 0x00,	// '-'
+	0x03, 0x82, 0x00, 0x02, 0x60, 0x60, 0x00,	// '.'
+	0x0A, 0x01, 0xFE, 0xFF, 0x85, 0x03, 0x03, 0xFF, 0xFE, 0x3F, 0x7F, 0x85, 0x60, 0x01, 0x7F, 0x3F,	// '0'
+	0x0A, 0x87, 0x00, 0x01, 0xFE, 0xFE, 0x87, 0x00, 0x01, 0x3F, 0x3F,	// '1'
+	0x0A, 0x00, 0xC0, 0x86, 0xC3, 0x03, 0xFF, 0xFE, 0x3F, 0x7F, 0x86, 0x60, 0x00, 0x00,	// '2'
+	0x0A, 0x00, 0x00, 0x86, 0xC3, 0x02, 0xFF, 0xFE, 0x00, 0x86, 0x60, 0x01, 0x7F, 0x3F,	// '3'
+	0x0A, 0x01, 0xFE, 0xFE, 0x85, 0xC0, 0x01, 0xFE, 0xFE, 0x87, 0x00, 0x01, 0x3F, 0x3F,	// '4'
+	0x0A, 0x01, 0xFE, 0xFF, 0x86, 0xC3, 0x01, 0xC0, 0x00, 0x86, 0x60, 0x01, 0x7F, 0x3F,	// '5'
+	0x0A, 0x01, 0xFE, 0xFF, 0x86, 0xC3, 0x02, 0xC0, 0x3F, 0x7F, 0x85, 0x60, 0x01, 0x7F, 0x3F,	// '6'
+	0x0A, 0x00, 0x00, 0x86, 0x03, 0x01, 0xFF, 0xFE, 0x87, 0x00, 0x01, 0x3F, 0x3F,	// '7'
+	0x0A, 0x01, 0xFE, 0xFF, 0x85, 0xC3, 0x03, 0xFF, 0xFE, 0x3F, 0x7F, 0x85, 0x60, 0x01, 0x7F, 0x3F,	// '8'
+	0x0A, 0x01, 0xFE, 0xFF, 0x85, 0xC3, 0x02, 0xFF, 0xFE, 0x00, 0x86, 0x60, 0x01, 0x7F, 0x3F,	// '9'
+};
+
+static const uint16_t Font_Digits16_Offsets[] PROGMEM = {
+	0, 3, 3, 3, 3, 3, 25, 25,
+	25, 25, 25, 25, 25, 25, 32, 39,
+	39, 55, 66, 80, 94, 108, 122, 137,
+	150, 166, 181,
+};
+
+const GLCD_FontType Font_Digits16 PROGMEM = {
+	10, 16, 0x20, 0x39, 1, GLCD_FONT_RLE, Font_Digits16_Offsets, Font_Digits16_Data
+};
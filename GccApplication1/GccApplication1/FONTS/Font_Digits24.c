@@ -0,0 +1,43 @@
+/*
+ * Font_Digits24.c
+ *
+ * Created: 19-Oct-26
+ *  Author: diaag
+ *
+ * Seven segment style numeric font, 14x24 digits, 3 px strokes, 2 column spacing. Codes 0x20..0x39
+ * with glyphs for ' ', '%', '-', '.' and '0'..'9'; the other codes of the
+ * range are missing. Column-RLE coded: 275 bytes (572 raw).
+ */ 
+
+#include <stdint.h>
+#include <avr/pgmspace.h>
+
+#include "Fonts.h"
+
+static const uint8_t Font_Digits24_Data[] PROGMEM = {
+	0x0E, 0xA9, 0x00,	// ' '
+	0x0E, 0x03, 0x0F, 0x09, 0x09, 0x0F, 0x84, 0x00, 0x04, 0xC0, 0xE0, 0x38, 0x1E, 0x07, 0x83, 0x00, 0x05, 0x80, 0xE0, 0x70, 0x1C, 0x0F, 0x03, 0x83, 0x00, 0x05, 0x40, 0x70, 0x3C, 0x0E, 0x03, 0x01, 0x83, 0x00, 0x03, 0x78, 0x48, 0x48, 0x78,	// '%'
+	0x0E, 0x8E, 0x00, 0x8B, 0x1C, 0x8E, 0x00,	// '-'
+	0x04, 0x87, 0x00, 0x82, 0x70, 0x00, 0x00,	// '.'
+	0x0E, 0x02, 0xFE, 0xFF, 0xFF, 0x87, 0x07, 0x02, 0xFF, 0xFF, 0xFE, 0x82, 0xFF, 0x87, 0x00, 0x82, 0xFF, 0x02, 0x3F, 0x7F, 0x7F, 0x87, 0x70, 0x02, 0x7F, 0x7F, 0x3F,	// '0'
+	0x0E, 0x8A, 0x00, 0x82, 0xFE, 0x8A, 0x00, 0x82, 0xFF, 0x8A, 0x00, 0x82, 0x3F,	// '1'
+	0x0E, 0x00, 0x00, 0x89, 0x07, 0x02, 0xFF, 0xFF, 0xFE, 0x82, 0xFC, 0x87, 0x1C, 0x82, 0x1F, 0x02, 0x3F, 0x7F, 0x7F, 0x89, 0x70, 0x00, 0x00,	// '2'
+	0x0E, 0x00, 0x00, 0x89, 0x07, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x89, 0x1C, 0x82, 0xFF, 0x00, 0x00, 0x89, 0x70, 0x02, 0x7F, 0x7F, 0x3F,	// '3'
+	0x0E, 0x82, 0xFE, 0x87, 0x00, 0x82, 0xFE, 0x82, 0x1F, 0x87, 0x1C, 0x82, 0xFF, 0x8A, 0x00, 0x82, 0x3F,	// '4'
+	0x0E, 0x02, 0xFE, 0xFF, 0xFF, 0x89, 0x07, 0x00, 0x00, 0x82, 0x1F, 0x87, 0x1C, 0x82, 0xFC, 0x00, 0x00, 0x89, 0x70, 0x02, 0x7F, 0x7F, 0x3F,	// '5'
+	0x0E, 0x02, 0xFE, 0xFF, 0xFF, 0x89, 0x07, 0x00, 0x00, 0x82, 0xFF, 0x87, 0x1C, 0x82, 0xFC, 0x02, 0x3F, 0x7F, 0x7F, 0x87, 0x70, 0x02, 0x7F, 0x7F, 0x3F,	// '6'
+	0x0E, 0x00, 0x00, 0x89, 0x07, 0x02, 0xFF, 0xFF, 0xFE, 0x8A, 0x00, 0x82, 0xFF, 0x8A, 0x00, 0x82, 0x3F,	// '7'
+	0x0E, 0x02, 0xFE, 0xFF, 0xFF, 0x87, 0x07, 0x02, 0xFF, 0xFF, 0xFE, 0x82, 0xFF, 0x87, 0x1C, 0x82, 0xFF, 0x02, 0x3F, 0x7F, 0x7F, 0x87, 0x70, 0x02, 0x7F, 0x7F, 0x3F,	// '8'
+	0x0E, 0x02, 0xFE, 0xFF, 0xFF, 0x87, 0x07, 0x02, 0xFF, 0xFF, 0xFE, 0x82, 0x1F, 0x87, 0x1C, 0x82, 0xFF, 0x00, 0x00, 0x89, 0x70, 0x02, 0x7F, 0x7F, 0x3F,	// '9'
+};
+
+static const uint16_t Font_Digits24_Offsets[] PROGMEM = {
+	0, 3, 3, 3, 3, 3, 42, 42,
+	42, 42, 42, 42, 42, 42, 49, 56,
+	56, 83, 96, 119, 141, 158, 181, 206,
+	223, 250, 275,
+};
+
+const GLCD_FontType Font_Digits24 PROGMEM = {
+	14, 24, 0x20, 0x39, 2, GLCD_FONT_RLE, Font_Digits24_Offsets, Font_Digits24_Data
+};
@@ -0,0 +1,128 @@
+/*
+ * Font_Prop5x8.c
+ *
+ * Created: 19-Oct-26
+ *  Author: diaag
+ *
+ * Proportional 8 pixel font, the Font_5x8 glyphs with their blank columns
+ * trimmed (space is 2 columns) and 1 column spacing. Indexed, each glyph
+ * starts with its width: 439 bytes of glyph data plus 192 bytes of offsets.
+ */ 
+
+#include <stdint.h>
+#include <avr/pgmspace.h>
+
+#include "Fonts.h"
+
+static const uint8_t Font_Prop5x8_Data[] PROGMEM = {
+	0x02, 0x00, 0x00,	// 0x20 ' '
+	0x01, 0x2F,	// 0x21 '!'
+	0x03, 0x03, 0x00, 0x03,	// 0x22 '"'
+	0x05, 0x34, 0x1C, 0x36, 0x1C, 0x16,	// 0x23 '#'
+	0x03, 0x26, 0x7F, 0x32,	// 0x24 '$'
+	0x05, 0x32, 0x0D, 0x1E, 0x2C, 0x13,	// 0x25 '%'
+	0x05, 0x18, 0x26, 0x2D, 0x12, 0x28,	// 0x26 '&'
+	0x01, 0x03,	// 0x27 '''
+	0x04, 0x1C, 0x22, 0x41, 0x41,	// 0x28 '('
+	0x04, 0x41, 0x41, 0x22, 0x1C,	// 0x29 ')'
+	0x03, 0x0A, 0x05, 0x0A,	// 0x2A '*'
+	0x03, 0x10, 0x38, 0x10,	// 0x2B '+'
+	0x02, 0x80, 0x60,	// 0x2C ','
+	0x03, 0x08, 0x08, 0x08,	// 0x2D '-'
+	0x01, 0x20,	// 0x2E '.'
+	0x04, 0x60, 0x18, 0x06, 0x01,	// 0x2F '/'
+	0x04, 0x1E, 0x21, 0x21, 0x1E,	// 0x30 '0'
+	0x03, 0x22, 0x3F, 0x20,	// 0x31 '1'
+	0x03, 0x31, 0x29, 0x26,	// 0x32 '2'
+	0x03, 0x25, 0x25, 0x1A,	// 0x33 '3'
+	0x04, 0x0C, 0x0A, 0x3F, 0x08,	// 0x34 '4'
+	0x03, 0x27, 0x25, 0x19,	// 0x35 '5'
+	0x04, 0x1E, 0x25, 0x25, 0x18,	// 0x36 '6'
+	0x04, 0x01, 0x39, 0x05, 0x03,	// 0x37 '7'
+	0x04, 0x1A, 0x25, 0x25, 0x1A,	// 0x38 '8'
+	0x04, 0x06, 0x29, 0x29, 0x1E,	// 0x39 '9'
+	0x01, 0x24,	// 0x3A ':'
+	0x02, 0x80, 0x64,	// 0x3B ';'
+	0x04, 0x08, 0x08, 0x14, 0x22,	// 0x3C '<'
+	0x04, 0x14, 0x14, 0x14, 0x14,	// 0x3D '='
+	0x04, 0x22, 0x14, 0x08, 0x08,	// 0x3E '>'
+	0x04, 0x01, 0x29, 0x05, 0x02,	// 0x3F '?'
+	0x05, 0x3C, 0x42, 0x59, 0x55, 0x5E,	// 0x40 '@'
+	0x05, 0x30, 0x1C, 0x12, 0x1C, 0x30,	// 0x41 'A'
+	0x03, 0x3E, 0x2A, 0x36,	// 0x42 'B'
+	0x04, 0x1C, 0x22, 0x22, 0x22,	// 0x43 'C'
+	0x04, 0x3E, 0x22, 0x22, 0x1C,	// 0x44 'D'
+	0x03, 0x3E, 0x2A, 0x2A,	// 0x45 'E'
+	0x03, 0x3E, 0x0A, 0x0A,	// 0x46 'F'
+	0x04, 0x1C, 0x22, 0x2A, 0x3A,	// 0x47 'G'
+	0x04, 0x3E, 0x08, 0x08, 0x3E,	// 0x48 'H'
+	0x03, 0x22, 0x3E, 0x22,	// 0x49 'I'
+	0x03, 0x22, 0x22, 0x1E,	// 0x4A 'J'
+	0x04, 0x3E, 0x08, 0x14, 0x22,	// 0x4B 'K'
+	0x04, 0x3E, 0x20, 0x20, 0x20,	// 0x4C 'L'
+	0x05, 0x3E, 0x04, 0x18, 0x04, 0x3E,	// 0x4D 'M'
+	0x04, 0x3E, 0x04, 0x08, 0x3E,	// 0x4E 'N'
+	0x05, 0x1C, 0x22, 0x22, 0x22, 0x1C,	// 0x4F 'O'
+	0x04, 0x3E, 0x0A, 0x0A, 0x04,	// 0x50 'P'
+	0x05, 0x1C, 0x22, 0x22, 0x62, 0x9C,	// 0x51 'Q'
+	0x04, 0x3E, 0x0A, 0x14, 0x20,	// 0x52 'R'
+	0x03, 0x24, 0x2A, 0x12,	// 0x53 'S'
+	0x05, 0x02, 0x02, 0x3E, 0x02, 0x02,	// 0x54 'T'
+	0x04, 0x1E, 0x20, 0x20, 0x1E,	// 0x55 'U'
+	0x04, 0x0E, 0x30, 0x30, 0x0E,	// 0x56 'V'
+	0x05, 0x0E, 0x30, 0x0C, 0x30, 0x0E,	// 0x57 'W'
+	0x05, 0x22, 0x14, 0x08, 0x14, 0x22,	// 0x58 'X'
+	0x05, 0x02, 0x04, 0x38, 0x04, 0x02,	// 0x59 'Y'
+	0x04, 0x32, 0x2A, 0x2A, 0x26,	// 0x5A 'Z'
+	0x02, 0x7F, 0x41,	// 0x5B '['
+	0x04, 0x01, 0x06, 0x18, 0x60,	// 0x5C
+	0x02, 0x41, 0x7F,	// 0x5D ']'
+	0x05, 0x18, 0x06, 0x01, 0x06, 0x18,	// 0x5E '^'
+	0x05, 0x40, 0x40, 0x40, 0x40, 0x40,	// 0x5F '_'
+	0x02, 0x01, 0x02,	// 0x60 '`'
+	0x04, 0x34, 0x34, 0x38, 0x20,	// 0x61 'a'
+	0x04, 0x3F, 0x24, 0x24, 0x18,	// 0x62 'b'
+	0x03, 0x18, 0x24, 0x24,	// 0x63 'c'
+	0x04, 0x18, 0x24, 0x24, 0x3F,	// 0x64 'd'
+	0x03, 0x18, 0x2C, 0x28,	// 0x65 'e'
+	0x04, 0x04, 0x3E, 0x05, 0x05,	// 0x66 'f'
+	0x04, 0x58, 0x54, 0x54, 0x3C,	// 0x67 'g'
+	0x04, 0x3F, 0x08, 0x04, 0x38,	// 0x68 'h'
+	0x02, 0x04, 0x3D,	// 0x69 'i'
+	0x03, 0x44, 0x44, 0x3D,	// 0x6A 'j'
+	0x04, 0x3F, 0x08, 0x14, 0x20,	// 0x6B 'k'
+	0x02, 0x01, 0x3F,	// 0x6C 'l'
+	0x05, 0x3C, 0x08, 0x3C, 0x08, 0x3C,	// 0x6D 'm'
+	0x04, 0x3C, 0x08, 0x04, 0x38,	// 0x6E 'n'
+	0x04, 0x18, 0x24, 0x24, 0x18,	// 0x6F 'o'
+	0x04, 0x7C, 0x24, 0x24, 0x18,	// 0x70 'p'
+	0x04, 0x18, 0x24, 0x24, 0x7C,	// 0x71 'q'
+	0x03, 0x3C, 0x08, 0x04,	// 0x72 'r'
+	0x03, 0x28, 0x2C, 0x14,	// 0x73 's'
+	0x04, 0x04, 0x1E, 0x24, 0x04,	// 0x74 't'
+	0x04, 0x1C, 0x20, 0x10, 0x3C,	// 0x75 'u'
+	0x04, 0x0C, 0x30, 0x30, 0x0C,	// 0x76 'v'
+	0x05, 0x0C, 0x30, 0x1C, 0x30, 0x0C,	// 0x77 'w'
+	0x04, 0x24, 0x18, 0x18, 0x24,	// 0x78 'x'
+	0x05, 0x40, 0x4C, 0x70, 0x30, 0x0C,	// 0x79 'y'
+	0x03, 0x34, 0x2C, 0x2C,	// 0x7A 'z'
+	0x03, 0x08, 0x36, 0x41,	// 0x7B '{'
+	0x01, 0x7F,	// 0x7C '|'
+	0x03, 0x41, 0x36, 0x08,	// 0x7D '}'
+	0x05, 0x10, 0x08, 0x08, 0x10, 0x08,	// 0x7E '~'
+};
+
+static const uint16_t Font_Prop5x8_Offsets[] PROGMEM = {
+	0, 3, 5, 9, 15, 19, 25, 31, 33, 38, 43, 47,
+	51, 54, 58, 60, 65, 70, 74, 78, 82, 87, 91, 96,
+	101, 106, 111, 113, 116, 121, 126, 131, 136, 142, 148, 152,
+	157, 162, 166, 170, 175, 180, 184, 188, 193, 198, 204, 209,
+	215, 220, 226, 231, 235, 241, 246, 251, 257, 263, 269, 274,
+	277, 282, 285, 291, 297, 300, 305, 310, 314, 319, 323, 328,
+	333, 338, 341, 345, 350, 353, 359, 364, 369, 374, 379, 383,
+	387, 392, 397, 402, 408, 413, 419, 423, 427, 429, 433, 439,
+};
+
+const GLCD_FontType Font_Prop5x8 PROGMEM = {
+	5, 8, 0x20, 0x7E, 1, 0, Font_Prop5x8_Offsets, Font_Prop5x8_Data
+};
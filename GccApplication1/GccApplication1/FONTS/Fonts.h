@@ -0,0 +1,22 @@
+/*
+ * Fonts.h
+ *
+ * Created: 19-Oct-26
+ *  Author: diaag
+ *
+ * Fonts in program memory, pass their address to the GLCD_Font functions.
+ */ 
+
+
+#ifndef FONTS_H_
+#define FONTS_H_
+
+#include "../GLCD_Font.h"
+
+extern const GLCD_FontType Font_5x8;		/* 5x8 fixed, 0x20..0x7E */
+extern const GLCD_FontType Font_Prop5x8;		/* Proportional 8 pixel, 0x20..0x7E, 1 column spacing */
+extern const GLCD_FontType Font_Digits16;	/* 10x16 numeric, " %-.0-9", 2 pages */
+extern const GLCD_FontType Font_Digits24;	/* 14x24 numeric, " %-.0-9", 3 pages */
+
+
+#endif /* FONTS_H_ */
@@ -10,10 +10,16 @@
 #define F_CPU 8000000UL
 #endif
 #include <util/delay.h>
+#include <avr/io.h>
+#include <avr/pgmspace.h>
 
 #include "MCAL/DIO/Dio.h"
 #include "GLCD_cfg.h"
 #include "GLCD.h"
+#include "LIB/BIT/Bit.h"
+#include "FONTS/Fonts.h"
+
+uint8_t GLCD_Orientation = GLCD_LANDSCAPE;
 
 void SELECTBOTH()   { Dio_WriteChannel(CS1, DIO_LOW); Dio_WriteChannel(CS2, DIO_LOW); }
 
@@ -67,32 +73,399 @@ void GLCD_Init()
 	GLCD_Command(0x3F); /* Display ON */
 }
 
-void GLCD_PrintChar(char x,uint8_t row,uint8_t col)
+/* Reads the status register until the busy flag (D7) clears, leaves the bus as output */
+static void GLCD_WaitReady(void)
+{
+	uint8_t polls = GLCD_BUSY_POLLS;
+	uint8_t busy;
+
+	GLCD_BUS_INPUT();
+	GLCD_EN_PORT = (uint8_t)((GLCD_EN_PORT & ~GLCD_RS_MASK) | GLCD_RW_MASK);	/* Status register, read */
+	do {
+		GLCD_EN_PORT |= GLCD_EN_MASK;
+		_delay_us(GLCD_BURST_EN_US);
+		busy = GLCD_BUSY_PIN & GLCD_BUSY_MASK;
+		GLCD_EN_PORT &= (uint8_t)~GLCD_EN_MASK;
+		_delay_us(GLCD_BURST_EN_US);
+	} while (busy && --polls);
+	GLCD_EN_PORT &= (uint8_t)~GLCD_RW_MASK;
+	GLCD_BUS_OUTPUT();
+}
+
+/* One write cycle to the data (rs != 0) or command register once the controller is ready */
+static void GLCD_Strobe(uint8_t rs, uint8_t value)
+{
+	/* The strobes are at the KS0108 minimum, so every byte waits out the busy time first */
+	GLCD_WaitReady();
+	if (rs) {
+		GLCD_EN_PORT |= GLCD_RS_MASK;
+	} else {
+		GLCD_EN_PORT &= (uint8_t)~GLCD_RS_MASK;
+	}
+	GLCD_BUS_PUT(value);
+	GLCD_EN_PORT |= GLCD_EN_MASK;
+	_delay_us(GLCD_BURST_EN_US);
+	GLCD_EN_PORT &= (uint8_t)~GLCD_EN_MASK;
+	_delay_us(GLCD_BURST_EN_US);
+}
+
+/* One read cycle of the data register, the address moves on by one column */
+static uint8_t GLCD_ReadCycle(void)
+{
+	uint8_t Data;
+
+	GLCD_WaitReady();
+	GLCD_BUS_INPUT();
+	GLCD_EN_PORT |= GLCD_RS_MASK | GLCD_RW_MASK;	/* Data register, read */
+	GLCD_EN_PORT |= GLCD_EN_MASK;
+	_delay_us(GLCD_BURST_EN_US);
+	Data = GLCD_BUS_GET();
+	GLCD_EN_PORT &= (uint8_t)~GLCD_EN_MASK;
+	_delay_us(GLCD_BURST_EN_US);
+	GLCD_EN_PORT &= (uint8_t)~GLCD_RW_MASK;
+	GLCD_BUS_OUTPUT();
+	return Data;
+}
+
+/* Page and column within the selected half */
+static void GLCD_Address(uint8_t page, uint8_t col)
+{
+	GLCD_Strobe(0, 0x40 + (col & 0x3F));	/* Set Y address (column within half) */
+	GLCD_Strobe(0, 0xB8 + (page & 0x07));	/* Set x address (page) */
+}
+
+void GLCD_SetCursor(uint8_t page, uint8_t col)
 {
-	int i = col ;
-	for(i = col; i < 5+col; i++)
+	if (col < 64) {
+		SELECTFIRST();
+	} else {
+		SELECTSECOND();
+	}
+	GLCD_Address(page, col);
+}
+
+/* Data bytes to consecutive columns of one half from the current address, data == 0 repeats value */
+static void GLCD_Burst(const uint8_t* data, uint8_t value, uint8_t n)
+{
+	while (n--)
 	{
-		if (64==i) {
-			SELECTSECOND();
-			GLCD_Command(0x40);		/* Set Y address (column=0) */
-			GLCD_Command(0xB8+row);
+		if (data) {
+			value = *data++;
 		}
-		GLCD_Data(font[x][i-col]);
+		GLCD_Strobe(1, value);
 	}
 }
-void Print_String(char* x,uint8_t row)
+
+/* Panel row write, one burst per half; data == 0 fills with value */
+static void GLCD_RowRaw(uint8_t page, uint8_t col, const uint8_t* data, uint8_t value, uint8_t len)
 {
-	int i = 0,col =0;
-	SELECTFIRST();
-	GLCD_Command(0x40);
-	GLCD_Command((0xB8) + row);
-	
-	while (x[i])
+	uint8_t n;
+
+	if (col >= 128) {
+		return;
+	}
+	if (len > 128 - col) {
+		len = 128 - col;
+	}
+	if (col < 64 && len != 0)
 	{
-		GLCD_PrintChar(x[i],row,col);
-		i++; col+=5;
+		n = (len < 64 - col) ? len : (uint8_t)(64 - col);
+		GLCD_SetCursor(page, col);
+		GLCD_Burst(data, value, n);
+		if (data) {
+			data += n;
+		}
+		col += n;
+		len -= n;
+	}
+	if (len != 0)
+	{
+		GLCD_SetCursor(page, col);
+		GLCD_Burst(data, value, len);
+	}
+}
+
+static void GLCD_ReadRowRaw(uint8_t page, uint8_t col, uint8_t* data, uint8_t len)
+{
+	uint8_t start = col;
+
+	GLCD_SetCursor(page, col);
+	GLCD_ReadCycle();		/* Dummy read after setting the address */
+	while (len-- && col < 128)
+	{
+		if (64 == col && start < 64) {
+			GLCD_SetCursor(page, col);
+			GLCD_ReadCycle();	/* New address, new dummy read */
+		}
+		*data++ = GLCD_ReadCycle();
+		col++;
+	}
+}
+
+/*
+ * Portrait: the logical screen is 64 x 128, logical pixel (x, y) is panel
+ * pixel (y, 63 - x). Logical page-major bytes are columns of 8 logical rows,
+ * which are 8 panel columns of one panel page, so they are moved in blocks
+ * of 8 logical columns: logical columns 8bx..8bx+7 of logical page lp are
+ * the 8 bytes of panel page 7 - bx from column 8lp, one 8x8 transpose apart.
+ */
+/* Block write into the half selected by the caller, two commands and an 8 byte burst */
+static void GLCD_PortraitWriteBlock(uint8_t page, uint8_t bx, const uint8_t* cols)
+{
+	uint8_t in[8], out[8], r;
+	for (r = 0; r < 8; r++) {
+		in[r] = cols[7 - r];	/* Logical x grows towards the panel top */
+	}
+	Bit_Transpose8x8(in, out);
+	GLCD_Address(7 - bx, page * 8);
+	GLCD_Burst(out, 0, 8);
+}
+
+static void GLCD_PortraitReadBlock(uint8_t page, uint8_t bx, uint8_t* cols)
+{
+	uint8_t in[8], out[8], i;
+	GLCD_ReadRowRaw(7 - bx, page * 8, in, 8);
+	Bit_Transpose8x8(in, out);
+	for (i = 0; i < 8; i++) {
+		cols[i] = out[7 - i];
+	}
+}
+
+/* Logical row write in portrait, data == 0 fills with value; blocks only partly covered are read first.
+ * All blocks of a logical row are in one half (panel columns 8 * page), it is selected once. */
+static void GLCD_PortraitRow(uint8_t page, uint8_t col, const uint8_t* data, uint8_t value, uint8_t len)
+{
+	uint8_t cols[8];
+	uint8_t end, bx, i, c;
+
+	if (page >= 16 || col >= 64) {
+		return;
+	}
+	if (len > 64 - col) {
+		len = 64 - col;
+	}
+	end = col + len;
+	if (page < 8) {
+		SELECTFIRST();
+	} else {
+		SELECTSECOND();
+	}
+	for (bx = col >> 3; bx * 8 < end; bx++) {
+		if (col > bx * 8 || end < bx * 8 + 8) {
+			GLCD_PortraitReadBlock(page, bx, cols);	/* Selects the same half */
+		}
+		for (i = 0; i < 8; i++) {
+			c = bx * 8 + i;
+			if (c >= col && c < end) {
+				cols[i] = data ? data[c - col] : value;
+			}
+		}
+		GLCD_PortraitWriteBlock(page, bx, cols);
+	}
+}
+
+void GLCD_SetOrientation(uint8_t orientation)
+{
+	GLCD_Orientation = orientation;
+}
+
+void GLCD_WriteRow(uint8_t page, uint8_t col, const uint8_t* data, uint8_t len)
+{
+	if (GLCD_Orientation == GLCD_PORTRAIT) {
+		if (data != 0) {
+			GLCD_PortraitRow(page, col, data, 0, len);
+		}
+	} else {
+		GLCD_RowRaw(page, col, data, 0, len);
+	}
+}
+
+void GLCD_FillRun(uint8_t page, uint8_t col, uint8_t value, uint8_t len)
+{
+	if (GLCD_Orientation == GLCD_PORTRAIT) {
+		GLCD_PortraitRow(page, col, 0, value, len);
+	} else {
+		GLCD_RowRaw(page, col, 0, value, len);
 	}
 }
+
+#if GLCD_BENCH
+/* Row write time in us of the pages [0, pages) at col, Timer0 at F_CPU / 64 restarted per row */
+static uint16_t GLCD_BenchRows(uint8_t pages, uint8_t col, const uint8_t* data, uint8_t len)
+{
+	uint32_t ticks = 0;
+	uint8_t p;
+
+	for (p = 0; p < pages; p++) {
+		TCNT0 = 0;
+		GLCD_WriteRow(p, col, data, len);
+		ticks += TCNT0;
+	}
+	return (uint16_t)(ticks * (64000000UL / F_CPU));
+}
+
+void GLCD_Bench(GLCD_BenchType* result)
+{
+	uint8_t data[128];
+	uint8_t tccr0 = TCCR0;
+	uint8_t orientation = GLCD_Orientation;
+	uint8_t x;
+
+	for (x = 0; x < 128; x++) {
+		data[x] = (uint8_t)(0x55u << (x & 1u));
+	}
+	TCCR0 = 3u;		/* One row is well below 256 ticks */
+	GLCD_Orientation = GLCD_LANDSCAPE;
+	result->LandscapeUs = GLCD_BenchRows(8, 0, data, 128);
+	result->LandscapePartUs = GLCD_BenchRows(8, 2, data, 4);
+	GLCD_Orientation = GLCD_PORTRAIT;
+	result->PortraitUs = GLCD_BenchRows(16, 0, data, 64);
+	result->PortraitPartUs = GLCD_BenchRows(16, 2, data, 4);
+	GLCD_Orientation = orientation;
+	TCCR0 = tccr0;
+}
+#endif /* GLCD_BENCH */
+
+void GLCD_ReadRow(uint8_t page, uint8_t col, uint8_t* data, uint8_t len)
+{
+	uint8_t cols[8];
+	uint8_t end, bx, i, c;
+
+	if (GLCD_Orientation != GLCD_PORTRAIT) {
+		GLCD_ReadRowRaw(page, col, data, len);
+		return;
+	}
+	if (page >= 16 || col >= 64) {
+		return;
+	}
+	if (len > 64 - col) {
+		len = 64 - col;
+	}
+	end = col + len;
+	for (bx = col >> 3; bx * 8 < end; bx++) {
+		GLCD_PortraitReadBlock(page, bx, cols);
+		for (i = 0; i < 8; i++) {
+			c = bx * 8 + i;
+			if (c >= col && c < end) {
+				data[c - col] = cols[i];
+			}
+		}
+	}
+}
+
+uint8_t GLCD_ReadData(uint8_t page, uint8_t col)
+{
+	uint8_t Data;
+	GLCD_ReadRow(page, col, &Data, 1);
+	return Data;
+}
+
+void GLCD_InvertRow(uint8_t page, uint8_t col, uint8_t mask, uint8_t len)
+{
+	uint8_t row[128];
+	uint8_t i;
+
+	if (col >= GLCD_WIDTH) {
+		return;
+	}
+	if (len > GLCD_WIDTH - col) {
+		len = GLCD_WIDTH - col;
+	}
+	GLCD_ReadRow(page, col, row, len);
+	for (i = 0; i < len; i++) {
+		row[i] ^= mask;
+	}
+	GLCD_WriteRow(page, col, row, len);
+}
+
+void GLCD_SetPixel(uint8_t x, uint8_t y, uint8_t mode)
+{
+	uint8_t Data, bit, t;
+
+	if (x >= GLCD_WIDTH || y >= GLCD_HEIGHT) {
+		return;
+	}
+	if (GLCD_Orientation == GLCD_PORTRAIT) {
+		/* One pixel needs no transpose, work on the panel byte directly */
+		t = x;
+		x = y;
+		y = 63 - t;
+	}
+	bit = (uint8_t)(1u << (y & 7));
+	GLCD_ReadRowRaw(y >> 3, x, &Data, 1);
+	if (mode == GLCD_PIXEL_SET) {
+		Data |= bit;
+	} else if (mode == GLCD_PIXEL_CLEAR) {
+		Data &= (uint8_t)~bit;
+	} else {
+		Data ^= bit;
+	}
+	GLCD_RowRaw(y >> 3, x, &Data, 0, 1);	/* Re-addresses, the read moved the column */
+}
+
+/* Text in Font_5x8, 5 column cells: the columns of a whole line go out in one GLCD_WriteRow.
+ * At most len glyphs are drawn, fewer when the string ends or the line is full. */
+static void GLCD_Text(const char* x, uint8_t flash, uint8_t len, uint8_t row, uint8_t col)
+{
+	uint8_t line[128];
+	uint8_t n, i;
+
+	if (col >= GLCD_WIDTH) {
+		return;
+	}
+	n = GLCD_WIDTH - col;
+	if (len <= n / 5) {
+		n = len * 5;
+	}
+	for (i = 0; i < n; i++) {
+		line[i] = 0x00;		/* Codes without a glyph are blank cells */
+	}
+	if (flash) {
+		n = GLCD_Font_RenderPage_P(&Font_5x8, x, 0, 5, line, n);
+	} else {
+		n = GLCD_Font_RenderPage(&Font_5x8, x, 0, 5, line, n);
+	}
+	GLCD_WriteRow(row, col, line, n);
+}
+
+void GLCD_PrintChar(char x,uint8_t row,uint8_t col)
+{
+	char s[2];
+
+	s[0] = x;
+	s[1] = '\0';
+	GLCD_Text(s, 0, 1, row, col);
+}
+
+void GLCD_PrintText(const char* x, uint8_t len, uint8_t row, uint8_t col)
+{
+	GLCD_Text(x, 0, len, row, col);
+}
+
+void Print_String(char* x,uint8_t row)
+{
+	GLCD_Text(x, 0, 0xFF, row, 0);
+}
+
+void Print_String_P(const char* x,uint8_t row)
+{
+	GLCD_Text(x, 1, 0xFF, row, 0);
+}
+
+char* GLCD_LoadTemplate_P(char* buf, const char* tpl, uint8_t size)
+{
+	uint8_t i = 0;
+
+	if (size == 0) {
+		return buf;
+	}
+	while (i < size - 1 && (buf[i] = pgm_read_byte(&tpl[i])) != '\0') {
+		i++;
+	}
+	buf[i] = '\0';
+	return buf;
+}
+
 void GLCD_ClearAll()			/* GLCD all display clear function */
 {
 	int i,j;
@@ -9,20 +9,72 @@
 #ifndef GLCD_H_
 #define GLCD_H_
 
+#include <stdint.h>
 
 #define LOWVOLT		(0b10000000)
 #define HIGHVOLT	(0b00000001)
 #define CHANGEVOLT	(0b11111111)
 #define ZEROVOLT	(0b00010000)
 
+/* Orientation, GLCD_SetOrientation */
+#define GLCD_LANDSCAPE		(0u)	/* 128 x 64, page p is pixel rows 8p..8p+7 */
+#define GLCD_PORTRAIT		(1u)	/* 64 x 128, panel turned 90 degrees clockwise */
+
+extern uint8_t GLCD_Orientation;
+
+/* Logical screen size in the current orientation */
+#define GLCD_WIDTH		((GLCD_Orientation == GLCD_PORTRAIT) ? 64u : 128u)
+#define GLCD_HEIGHT		((GLCD_Orientation == GLCD_PORTRAIT) ? 128u : 64u)
+#define GLCD_PAGES		(GLCD_HEIGHT / 8u)
+
+/* Enable high and low time of the row bursts, the KS0108 minimum is 450 ns each */
+#define GLCD_BURST_EN_US	(0.5)
+
+/* Bus time of a burst byte: a status read that finds the controller ready plus the write
+ * strobe. The controller may stay busy longer, the burst polls until it is ready. */
+#define GLCD_BURST_BYTE_US	(4.0 * GLCD_BURST_EN_US)
+
+/* Status reads before a burst gives up waiting, e.g. with no panel connected */
+#define GLCD_BUSY_POLLS		(100u)
+
+/* On-target landscape vs portrait timing, GLCD_Bench */
+#define GLCD_BENCH			(0u)
+
+typedef struct
+{
+	uint16_t LandscapeUs;		/* 8 pages of 128 columns */
+	uint16_t PortraitUs;		/* The same screen as 16 rows of 64 columns */
+	uint16_t LandscapePartUs;	/* A 4 column run on each of the 8 pages */
+	uint16_t PortraitPartUs;	/* The same run on each of the 16 rows, half a block each */
+} GLCD_BenchType;
+
+/* GLCD_SetPixel modes */
+#define GLCD_PIXEL_SET		(0u)
+#define GLCD_PIXEL_CLEAR	(1u)
+#define GLCD_PIXEL_XOR		(2u)
+
 
 
 extern void GLCD_Command(char Command);		/* GLCD command function */
 extern void GLCD_Data(char Data)	;	/* GLCD data function */
 extern void GLCD_Init()		;	/* GLCD initialize function */
-extern void GLCD_PrintChar(char x,uint8_t row,uint8_t col);
+extern void GLCD_SetCursor(uint8_t page, uint8_t col);	/* Select half, page and column (0..127), panel addressing */
+extern void GLCD_SetOrientation(uint8_t orientation);	/* GLCD_LANDSCAPE / GLCD_PORTRAIT for everything drawn through the row functions */
+extern void GLCD_WriteRow(uint8_t page, uint8_t col, const uint8_t* data, uint8_t len);	/* len column bytes from any column, clipped at GLCD_WIDTH */
+extern void GLCD_FillRun(uint8_t page, uint8_t col, uint8_t value, uint8_t len);	/* len copies of value from any column, clipped at GLCD_WIDTH */
+extern uint8_t GLCD_ReadData(uint8_t page, uint8_t col);	/* Reads one display byte (dummy read included) */
+extern void GLCD_ReadRow(uint8_t page, uint8_t col, uint8_t* data, uint8_t len);	/* Burst read of len column bytes, clipped at GLCD_WIDTH */
+extern void GLCD_SetPixel(uint8_t x, uint8_t y, uint8_t mode);	/* Read-modify-write of one pixel, GLCD_PIXEL_xxx */
+extern void GLCD_InvertRow(uint8_t page, uint8_t col, uint8_t mask, uint8_t len);	/* XORs mask into len columns, e.g. a cursor */
+extern void GLCD_PrintChar(char x,uint8_t row,uint8_t col);	/* One 5 column glyph at any column */
+extern void GLCD_PrintText(const char* x, uint8_t len, uint8_t row, uint8_t col);	/* len glyphs from any column */
 extern void Print_String(char* x,uint8_t row);
+extern void Print_String_P(const char* x,uint8_t row);	/* x in program memory, e.g. PSTR("...") */
+extern char* GLCD_LoadTemplate_P(char* buf, const char* tpl, uint8_t size);	/* Copies a flash template into a RAM line buffer of size bytes */
 extern void GLCD_ClearAll()		; /* GLCD all display clear function */
+#if GLCD_BENCH
+extern void GLCD_Bench(GLCD_BenchType* result);	/* Draws over the screen, borrows Timer0, run before GLCD_Gray_Init */
+#endif
 extern  void SELECTBOTH();
 extern  void SELECTFIRST();
 extern  void SELECTSECOND();
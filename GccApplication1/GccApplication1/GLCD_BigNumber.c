@@ -0,0 +1,59 @@
+/*
+ * GLCD_BigNumber.c
+ *
+ * Created: 19-Oct-26
+ *  Author: diaag
+ */ 
+
+#include <stdint.h>
+#include <avr/pgmspace.h>
+
+#include "GLCD.h"
+#include "GLCD_Font.h"
+#include "GLCD_BigNumber.h"
+
+void GLCD_BigNumber_Init(GLCD_BigNumberType* num, const GLCD_FontType* font, uint8_t page, uint8_t col, uint8_t chars)
+{
+	uint8_t cell = pgm_read_byte(&font->Width) + pgm_read_byte(&font->Spacing);
+	uint8_t fit = (col < GLCD_WIDTH) ? (uint8_t)((GLCD_WIDTH - col) / cell) : 0;
+
+	if (chars > GLCD_BIGNUMBER_MAX_CHARS) {
+		chars = GLCD_BIGNUMBER_MAX_CHARS;
+	}
+	if (chars > fit) {
+		chars = fit;
+	}
+	num->Font = font;
+	num->Page = page;
+	num->Col = col;
+	num->Cell = cell;
+	num->Chars = chars;
+	GLCD_BigNumber_Invalidate(num);
+}
+
+void GLCD_BigNumber_Invalidate(GLCD_BigNumberType* num)
+{
+	uint8_t i;
+
+	for (i = 0; i < num->Chars; i++) {
+		num->Shown[i] = (char)0xFF;
+	}
+}
+
+void GLCD_DrawBigNumber(GLCD_BigNumberType* num, const char* text)
+{
+	uint8_t i, ended = 0;
+	char c;
+
+	for (i = 0; i < num->Chars; i++)
+	{
+		if (!ended && text[i] == '\0') {
+			ended = 1;
+		}
+		c = ended ? ' ' : text[i];
+		if (c != num->Shown[i]) {
+			GLCD_Font_DrawCell(num->Font, c, num->Page, num->Col + i * num->Cell, num->Cell);
+			num->Shown[i] = c;
+		}
+	}
+}
@@ -0,0 +1,41 @@
+/*
+ * GLCD_BigNumber.h
+ *
+ * Created: 19-Oct-26
+ *  Author: diaag
+ *
+ * Large numeric readout. The readout is a row of fixed pitch cells (glyph
+ * width plus spacing of the font) and keeps the characters it has drawn, so
+ * an update only blits the cells that changed, one GLCD_WriteRow burst per
+ * page of the font.
+ */ 
+
+
+#ifndef GLCD_BIGNUMBER_H_
+#define GLCD_BIGNUMBER_H_
+
+#include <stdint.h>
+#include "GLCD_Font.h"
+
+#define GLCD_BIGNUMBER_MAX_CHARS	(12u)
+
+typedef struct {
+	const GLCD_FontType* Font;	/* Font in program memory, e.g. &Font_Digits16 */
+	uint8_t Page;		/* Top page of the readout */
+	uint8_t Col;		/* First column of the readout */
+	uint8_t Cell;		/* Cell pitch in columns */
+	uint8_t Chars;		/* Number of cells */
+	char Shown[GLCD_BIGNUMBER_MAX_CHARS];	/* Characters currently on the display */
+} GLCD_BigNumberType;
+
+/* Binds the readout, chars is clipped to the screen; the next draw fills every cell */
+extern void GLCD_BigNumber_Init(GLCD_BigNumberType* num, const GLCD_FontType* font, uint8_t page, uint8_t col, uint8_t chars);
+
+/* Forgets the drawn characters, e.g. after GLCD_ClearAll */
+extern void GLCD_BigNumber_Invalidate(GLCD_BigNumberType* num);
+
+/* Shows text left aligned (e.g. formatted with Fmt), cells past its end are blanked */
+extern void GLCD_DrawBigNumber(GLCD_BigNumberType* num, const char* text);
+
+
+#endif /* GLCD_BIGNUMBER_H_ */
@@ -0,0 +1,157 @@
+/*
+ * GLCD_Bitmap.c
+ *
+ * Created: 19-Oct-26
+ *  Author: diaag
+ */ 
+
+#include <stdint.h>
+#include <avr/pgmspace.h>
+
+#include "GLCD.h"
+#include "LIB/BIT/Bit.h"
+#include "GLCD_Bitmap.h"
+
+/* Columns drawn per pass: three buffers of this size are on the stack, a wider bitmap
+ * costs one more cursor set per page and strip */
+#define GLCD_BITMAP_STRIP	(32u)
+
+/* Combines the source bits under mask with the display byte */
+static uint8_t GLCD_Bitmap_Rop(uint8_t dst, uint8_t bits, uint8_t mask, uint8_t rop)
+{
+	switch (rop) {
+	case GLCD_ROP_OR:		return dst | bits;
+	case GLCD_ROP_AND:		return dst & (uint8_t)(bits | ~mask);
+	case GLCD_ROP_XOR:		return dst ^ bits;
+	case GLCD_ROP_INVERT:	return (uint8_t)((dst & ~mask) | (~bits & mask));
+	default:				return (uint8_t)((dst & ~mask) | bits);
+	}
+}
+
+/* Page-major bytes of source page sp, columns skip..skip + cols - 1, into out */
+static void GLCD_Bitmap_Fetch(const uint8_t* src, uint8_t w, uint8_t h, uint8_t rowMajor, uint8_t sp, uint8_t skip, uint8_t cols, uint8_t* out)
+{
+	uint8_t rows[8], block[8];
+	uint8_t stride, r, col, bx, k;
+	const uint8_t* s;
+
+	if (!rowMajor) {
+		s = src + (uint16_t)sp * w + skip;
+		for (col = 0; col < cols; col++) {
+			out[col] = pgm_read_byte(s++);
+		}
+		return;
+	}
+
+	/* Row-major source: transpose 8 rows x 8 columns at a time */
+	stride = (uint8_t)((w + 7) / 8);
+	col = 0;
+	for (bx = skip >> 3; col < cols; bx++) {
+		for (r = 0; r < 8; r++) {
+			rows[r] = (sp * 8 + r < h) ? pgm_read_byte(src + (uint16_t)(sp * 8 + r) * stride + bx) : 0x00;
+		}
+		Bit_Transpose8x8(rows, block);
+		/* Leftmost pixel is bit 7 of a row, so column bx * 8 + k is block[7 - k] */
+		for (k = (col == 0) ? (skip & 7) : 0; k < 8 && col < cols; k++) {
+			out[col++] = block[7 - k];
+		}
+	}
+}
+
+/* Source columns skip..skip + cols - 1 (at most GLCD_BITMAP_STRIP) at display column x */
+static void GLCD_Bitmap_DrawStrip(uint8_t x, int16_t y, uint8_t w, uint8_t h, const uint8_t* src, uint8_t rop, uint8_t rowMajor, uint8_t skip, uint8_t cols)
+{
+	uint8_t row[GLCD_BITMAP_STRIP], bufA[GLCD_BITMAP_STRIP], bufB[GLCD_BITMAP_STRIP];
+	uint8_t* cur = bufA;
+	uint8_t* prev = bufB;
+	uint8_t* t;
+	uint8_t pages = (uint8_t)((h + 7) / 8);
+	uint8_t lastMask = (h & 7) ? (uint8_t)((1u << (h & 7)) - 1u) : 0xFF;
+	uint8_t col, sp, mul, mask, maskLo, maskHi, needRead;
+	int16_t top, dp;
+	uint16_t lo, hi;
+
+	if ((y & 7) == 0)
+	{
+		/* Fast path: every source page lands on one display page */
+		top = y >> 3;
+		for (sp = 0; sp < pages; sp++) {
+			dp = top + sp;
+			if (dp < 0 || dp >= (int16_t)GLCD_PAGES) {
+				continue;
+			}
+			mask = (sp == pages - 1) ? lastMask : 0xFF;
+			needRead = (mask != 0xFF) || (rop != GLCD_ROP_COPY && rop != GLCD_ROP_INVERT);
+			if (needRead) {
+				GLCD_ReadRow((uint8_t)dp, x, row, cols);
+			}
+			GLCD_Bitmap_Fetch(src, w, h, rowMajor, sp, skip, cols, cur);
+			for (col = 0; col < cols; col++) {
+				row[col] = needRead ? GLCD_Bitmap_Rop(row[col], cur[col] & mask, mask, rop)
+				                    : GLCD_Bitmap_Rop(0x00, cur[col], 0xFF, rop);
+			}
+			GLCD_WriteRow((uint8_t)dp, x, row, cols);
+		}
+		return;
+	}
+
+	/* Shifted path: display page dp gets the low part of source page dp - top and the high part of the page above */
+	mul = Bit_Row(y);
+	top = y >> 3;
+	for (dp = top; dp <= top + pages; dp++) {
+		sp = (uint8_t)(dp - top);
+		t = prev; prev = cur; cur = t;
+		if (sp < pages) {
+			GLCD_Bitmap_Fetch(src, w, h, rowMajor, sp, skip, cols, cur);
+		}
+		if (dp < 0 || dp >= (int16_t)GLCD_PAGES) {
+			continue;
+		}
+		maskLo = (sp < pages) ? (uint8_t)(((sp == pages - 1) ? lastMask : 0xFF) * mul) : 0x00;
+		maskHi = (sp > 0) ? (uint8_t)((uint16_t)((sp - 1 == pages - 1) ? lastMask : 0xFF) * mul >> 8) : 0x00;
+		mask = maskLo | maskHi;
+		if (mask == 0) {
+			break;		/* The last source page does not reach this page */
+		}
+		GLCD_ReadRow((uint8_t)dp, x, row, cols);
+		for (col = 0; col < cols; col++) {
+			lo = (sp < pages) ? (uint16_t)cur[col] * mul : 0;
+			hi = (sp > 0) ? (uint16_t)prev[col] * mul : 0;
+			row[col] = GLCD_Bitmap_Rop(row[col], ((uint8_t)lo & maskLo) | ((uint8_t)(hi >> 8) & maskHi), mask, rop);
+		}
+		GLCD_WriteRow((uint8_t)dp, x, row, cols);
+	}
+}
+
+static void GLCD_Bitmap_Draw(int16_t x, int16_t y, uint8_t w, uint8_t h, const uint8_t* src, uint8_t rop, uint8_t rowMajor)
+{
+	uint8_t skip = 0, cols, done, n;
+
+	/* Horizontal clip: skip source columns left of the screen */
+	if (w == 0 || h == 0 || x >= (int16_t)GLCD_WIDTH || y >= (int16_t)GLCD_HEIGHT || x + w <= 0 || y + h <= 0) {
+		return;
+	}
+	if (x < 0) {
+		skip = (uint8_t)(-x);
+		x = 0;
+	}
+	cols = w - skip;
+	if (cols > GLCD_WIDTH - x) {
+		cols = (uint8_t)(GLCD_WIDTH - x);
+	}
+
+	for (done = 0; done < cols; done += n) {
+		n = ((uint8_t)(cols - done) > GLCD_BITMAP_STRIP) ? GLCD_BITMAP_STRIP : (uint8_t)(cols - done);
+		GLCD_Bitmap_DrawStrip((uint8_t)(x + done), y, w, h, src, rop, rowMajor, (uint8_t)(skip + done), n);
+	}
+}
+
+void GLCD_DrawBitmap(int16_t x, int16_t y, uint8_t w, uint8_t h, const uint8_t* src, uint8_t rop)
+{
+	GLCD_Bitmap_Draw(x, y, w, h, src, rop, 0);
+}
+
+void GLCD_DrawBitmapRows(int16_t x, int16_t y, uint8_t w, uint8_t h, const uint8_t* src, uint8_t rop)
+{
+	GLCD_Bitmap_Draw(x, y, w, h, src, rop, 1);
+}
@@ -0,0 +1,37 @@
+/*
+ * GLCD_Bitmap.h
+ *
+ * Created: 19-Oct-26
+ *  Author: diaag
+ *
+ * Bitmap blitter for images in program memory. A bitmap is w x h pixels
+ * stored page-major like the fonts: (h + 7) / 8 pages of w column bytes,
+ * bit 0 is the top row of a page. The bitmap is drawn straight on the
+ * display, clipped to the 128x64 screen, one burst per page:
+ *  - page aligned y with COPY or INVERT writes the bytes without reading;
+ *  - other cases shift each source byte into two pages (one 8x8 multiply)
+ *    and read the covered display bytes first, one burst read per page.
+ */ 
+
+
+#ifndef GLCD_BITMAP_H_
+#define GLCD_BITMAP_H_
+
+#include <stdint.h>
+
+/* Raster operations */
+#define GLCD_ROP_COPY	(0u)	/* dst = src */
+#define GLCD_ROP_OR		(1u)	/* dst = dst | src */
+#define GLCD_ROP_AND	(2u)	/* dst = dst & src */
+#define GLCD_ROP_XOR	(3u)	/* dst = dst ^ src */
+#define GLCD_ROP_INVERT	(4u)	/* dst = ~src */
+
+/* Draws the w x h bitmap src (program memory) with its top left pixel at x, y */
+extern void GLCD_DrawBitmap(int16_t x, int16_t y, uint8_t w, uint8_t h, const uint8_t* src, uint8_t rop);
+
+/* Same for a row-major bitmap: h rows of (w + 7) / 8 bytes, leftmost pixel in bit 7 (PBM P4
+   raster); converted to columns with the 8x8 transpose of LIB/BIT */
+extern void GLCD_DrawBitmapRows(int16_t x, int16_t y, uint8_t w, uint8_t h, const uint8_t* src, uint8_t rop);
+
+
+#endif /* GLCD_BITMAP_H_ */
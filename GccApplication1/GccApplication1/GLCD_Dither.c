@@ -0,0 +1,152 @@
+/*
+ * GLCD_Dither.c
+ *
+ * Created: 19-Oct-26
+ *  Author: diaag
+ */ 
+
+#include <stdint.h>
+#include <avr/pgmspace.h>
+
+#include "GLCD.h"
+#include "LIB/BIT/Bit.h"
+#include "GLCD_Dither.h"
+
+/* Column bytes per level and column phase x & 3, from GLCD_DITHER_BAYER4 */
+static const uint8_t GLCD_Dither_Pattern[GLCD_DITHER_LEVELS][4] PROGMEM = {
+	{ 0x00, 0x00, 0x00, 0x00 },	/*  0 */
+	{ 0x11, 0x00, 0x00, 0x00 },	/*  1 */
+	{ 0x11, 0x00, 0x44, 0x00 },	/*  2 */
+	{ 0x11, 0x00, 0x55, 0x00 },	/*  3 */
+	{ 0x55, 0x00, 0x55, 0x00 },	/*  4 */
+	{ 0x55, 0x22, 0x55, 0x00 },	/*  5 */
+	{ 0x55, 0x22, 0x55, 0x88 },	/*  6 */
+	{ 0x55, 0x22, 0x55, 0xAA },	/*  7 */
+	{ 0x55, 0xAA, 0x55, 0xAA },	/*  8 */
+	{ 0x55, 0xBB, 0x55, 0xAA },	/*  9 */
+	{ 0x55, 0xBB, 0x55, 0xEE },	/* 10 */
+	{ 0x55, 0xBB, 0x55, 0xFF },	/* 11 */
+	{ 0x55, 0xFF, 0x55, 0xFF },	/* 12 */
+	{ 0x77, 0xFF, 0x55, 0xFF },	/* 13 */
+	{ 0x77, 0xFF, 0xDD, 0xFF },	/* 14 */
+	{ 0x77, 0xFF, 0xFF, 0xFF },	/* 15 */
+	{ 0xFF, 0xFF, 0xFF, 0xFF },	/* 16 */
+};
+
+uint8_t GLCD_Dither_Byte(uint8_t level, uint8_t x)
+{
+	if (level >= GLCD_DITHER_LEVELS) {
+		level = GLCD_DITHER_LEVELS - 1;
+	}
+	return pgm_read_byte(&GLCD_Dither_Pattern[level][x & 3]);
+}
+
+/* Levels stepping evenly from from to to over n steps, Bresenham style so there is no division */
+typedef struct {
+	uint8_t Level;
+	uint8_t Err;
+	uint8_t Delta;
+	uint8_t Steps;
+	uint8_t Up;
+} GLCD_Dither_RampType;
+
+static void GLCD_Dither_RampInit(GLCD_Dither_RampType* ramp, uint8_t n, uint8_t from, uint8_t to)
+{
+	ramp->Level = from;
+	ramp->Err = 0;
+	ramp->Up = (to > from);
+	ramp->Delta = ramp->Up ? to - from : from - to;
+	ramp->Steps = n - 1;
+}
+
+/* Current level, then one step on */
+static uint8_t GLCD_Dither_RampNext(GLCD_Dither_RampType* ramp)
+{
+	uint8_t level = ramp->Level;
+
+	ramp->Err += ramp->Delta;
+	while (ramp->Steps != 0 && ramp->Err >= ramp->Steps) {
+		ramp->Err -= ramp->Steps;
+		ramp->Level = ramp->Up ? ramp->Level + 1 : ramp->Level - 1;
+	}
+	return level;
+}
+
+void GLCD_Dither_Gradient(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, uint8_t from, uint8_t to, uint8_t direction)
+{
+	uint8_t row[128];
+	GLCD_Dither_RampType ramp;
+	uint8_t n, page, last, mask, i, r, y, cx, level, bits;
+	uint8_t phase[4];
+
+	if (x0 > x1 || y0 > y1 || x0 >= GLCD_WIDTH || y0 >= GLCD_HEIGHT) {
+		return;
+	}
+	if (x1 >= GLCD_WIDTH) x1 = GLCD_WIDTH - 1;
+	if (y1 >= GLCD_HEIGHT) y1 = GLCD_HEIGHT - 1;
+	if (from >= GLCD_DITHER_LEVELS) from = GLCD_DITHER_LEVELS - 1;
+	if (to >= GLCD_DITHER_LEVELS) to = GLCD_DITHER_LEVELS - 1;
+	n = x1 - x0 + 1;
+
+	/* A vertical ramp steps once per pixel row, through all pages in order */
+	if (direction != GLCD_DITHER_HORIZONTAL) {
+		GLCD_Dither_RampInit(&ramp, y1 - y0 + 1, from, to);
+	}
+
+	last = y1 >> 3;
+	for (page = y0 >> 3; page <= last; page++)
+	{
+		mask = 0xFF;
+		if (page == y0 >> 3) {
+			mask &= Bit_FromRow(y0);
+		}
+		if (page == last) {
+			mask &= Bit_ToRow(y1);
+		}
+		if (direction != GLCD_DITHER_HORIZONTAL)
+		{
+			/* Each row of the page takes its bit from the pattern of its own level */
+			for (cx = 0; cx < 4; cx++) {
+				phase[cx] = 0;
+			}
+			for (r = 0; r < 8; r++) {
+				y = page * 8 + r;
+				if (y < y0 || y > y1) {
+					continue;
+				}
+				level = GLCD_Dither_RampNext(&ramp);
+				for (cx = 0; cx < 4; cx++) {
+					phase[cx] |= pgm_read_byte(&GLCD_Dither_Pattern[level][cx]) & Bit_Row(r);
+				}
+			}
+			if (phase[0] == phase[1] && phase[1] == phase[2] && phase[2] == phase[3] && mask == 0xFF) {
+				GLCD_FillRun(page, x0, phase[0], n);	/* Solid or clear page */
+				continue;
+			}
+		}
+		else
+		{
+			/* Pattern rows repeat every 4 rows, so every page restarts the same column ramp */
+			GLCD_Dither_RampInit(&ramp, n, from, to);
+		}
+
+		/* Partial pages are merged into the display bytes in place, one row buffer in all */
+		if (mask != 0xFF) {
+			GLCD_ReadRow(page, x0, row, n);
+		}
+		for (i = 0; i < n; i++) {
+			if (direction == GLCD_DITHER_HORIZONTAL) {
+				bits = pgm_read_byte(&GLCD_Dither_Pattern[GLCD_Dither_RampNext(&ramp)][(x0 + i) & 3]);
+			} else {
+				bits = phase[(x0 + i) & 3];
+			}
+			row[i] = (mask == 0xFF) ? bits : (uint8_t)((row[i] & ~mask) | (bits & mask));
+		}
+		GLCD_WriteRow(page, x0, row, n);
+	}
+}
+
+void GLCD_Dither_FillRect(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, uint8_t level)
+{
+	GLCD_Dither_Gradient(x0, y0, x1, y1, level, level, GLCD_DITHER_VERTICAL);
+}
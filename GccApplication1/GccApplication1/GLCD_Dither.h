@@ -0,0 +1,43 @@
+/*
+ * GLCD_Dither.h
+ *
+ * Created: 19-Oct-26
+ *  Author: diaag
+ *
+ * Ordered dither with the 4x4 Bayer matrix: 17 levels from clear (0) to
+ * solid (16), pixel (x, y) is set when its threshold is below the level.
+ * A page holds 8 rows, two periods of the matrix, so a level is just 4
+ * column bytes repeated along x; they are precomputed in program memory
+ * and a dithered area goes out as plain row bursts, no per-pixel work.
+ * Tools/ImgEnc dithers grayscale images with the same matrix.
+ */ 
+
+
+#ifndef GLCD_DITHER_H_
+#define GLCD_DITHER_H_
+
+#include <stdint.h>
+
+#define GLCD_DITHER_LEVELS		(17u)
+
+/* Threshold of pixel (x, y) is [y & 3][x & 3] */
+#define GLCD_DITHER_BAYER4		{ { 0, 8, 2, 10 }, { 12, 4, 14, 6 }, { 3, 11, 1, 9 }, { 15, 7, 13, 5 } }
+
+/* Gradient directions */
+#define GLCD_DITHER_HORIZONTAL	(0u)	/* Level from x0 to x1 */
+#define GLCD_DITHER_VERTICAL	(1u)	/* Level from y0 to y1 */
+
+/* Level of a darkness 0..255 */
+#define GLCD_DITHER_LEVEL(dark)	((uint8_t)(((uint16_t)(dark) * GLCD_DITHER_LEVELS) >> 8))
+
+/* Column byte of a level at screen column x */
+extern uint8_t GLCD_Dither_Byte(uint8_t level, uint8_t x);
+
+/* Rectangle x0..x1, y0..y1 (inclusive) in one level */
+extern void GLCD_Dither_FillRect(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, uint8_t level);
+
+/* Rectangle ramping from level from to level to along direction */
+extern void GLCD_Dither_Gradient(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, uint8_t from, uint8_t to, uint8_t direction);
+
+
+#endif /* GLCD_DITHER_H_ */
@@ -0,0 +1,146 @@
+/*
+ * GLCD_Fb.c
+ *
+ * Created: 19-Oct-26
+ *  Author: diaag
+ */ 
+
+#include <stdint.h>
+
+#include "GLCD.h"
+#include "LIB/BIT/Bit.h"
+#include "GLCD_Font.h"
+#include "GLCD_Fb.h"
+
+#if GLCD_FB_USED
+
+/* Screen page p lies in the band (one unsigned compare) */
+#define GLCD_FB_IN_BAND(p)	((uint8_t)((p) - GLCD_FB_FIRST_PAGE) < GLCD_FB_PAGES)
+
+uint8_t GLCD_Fb[GLCD_FB_PAGES][128];
+
+/* Dirty column span per page, clean when DirtyMin > DirtyMax */
+static uint8_t GLCD_Fb_DirtyMin[GLCD_FB_PAGES];
+static uint8_t GLCD_Fb_DirtyMax[GLCD_FB_PAGES];
+
+void GLCD_Fb_Clear(void)
+{
+	uint8_t p, x;
+
+	for (p = 0; p < GLCD_FB_PAGES; p++) {
+		for (x = 0; x < 128; x++) {
+			GLCD_Fb[p][x] = 0x00;
+		}
+		GLCD_Fb_DirtyMin[p] = 0;
+		GLCD_Fb_DirtyMax[p] = 127;
+	}
+}
+
+void GLCD_Fb_MarkDirty(uint8_t page, uint8_t x0, uint8_t x1)
+{
+	uint8_t p;
+
+	if (!GLCD_FB_IN_BAND(page)) {
+		return;
+	}
+	p = page - GLCD_FB_FIRST_PAGE;
+	if (GLCD_Fb_DirtyMin[p] > GLCD_Fb_DirtyMax[p]) {
+		GLCD_Fb_DirtyMin[p] = x0;
+		GLCD_Fb_DirtyMax[p] = x1;
+		return;
+	}
+	if (x0 < GLCD_Fb_DirtyMin[p]) {
+		GLCD_Fb_DirtyMin[p] = x0;
+	}
+	if (x1 > GLCD_Fb_DirtyMax[p]) {
+		GLCD_Fb_DirtyMax[p] = x1;
+	}
+}
+
+void GLCD_Fb_Flush(void)
+{
+	uint8_t p, x0, x1;
+
+	for (p = 0; p < GLCD_FB_PAGES; p++) {
+		x0 = GLCD_Fb_DirtyMin[p];
+		x1 = GLCD_Fb_DirtyMax[p];
+		if (x0 <= x1) {
+			GLCD_WriteRow(GLCD_FB_FIRST_PAGE + p, x0, &GLCD_Fb[p][x0], x1 - x0 + 1);
+			GLCD_Fb_DirtyMin[p] = 0xFF;
+			GLCD_Fb_DirtyMax[p] = 0x00;
+		}
+	}
+}
+
+/* Merges the source byte bits under mask into one buffer byte */
+static inline void GLCD_Fb_Merge(uint8_t* dst, uint8_t bits, uint8_t mask, uint8_t mode)
+{
+	switch (mode) {
+	case GLCD_FB_SET:	*dst = (uint8_t)((*dst & ~mask) | bits);	break;
+	case GLCD_FB_OR:	*dst |= bits;	break;
+	case GLCD_FB_XOR:	*dst ^= bits;	break;
+	default:		*dst &= (uint8_t)~bits;	break;
+	}
+}
+
+void GLCD_Fb_Blit(uint8_t x, uint8_t y, const uint8_t* src, uint8_t width, uint8_t height, uint8_t mode)
+{
+	uint8_t pages = (uint8_t)((height + 7) / 8);
+	/* 1 << s: the 16 bit product b * (1 << s) holds b shifted into its page (low byte) and the page below (high byte) */
+	uint8_t mul = Bit_Row(y);
+	uint8_t top = y >> 3;
+	uint8_t sp, col, dp, cols, mask, lastMask;
+	uint16_t bits, masks;
+
+	if (x >= 128 || y >= 64 || width == 0 || height == 0) {
+		return;
+	}
+	cols = (width > 128 - x) ? (uint8_t)(128 - x) : width;
+	lastMask = (height & 7) ? (uint8_t)((1u << (height & 7)) - 1u) : 0xFF;
+
+	for (sp = 0; sp < pages; sp++)
+	{
+		mask = (sp == pages - 1) ? lastMask : 0xFF;
+		masks = (uint16_t)mask * mul;
+		dp = top + sp;		/* Screen page receiving the low byte */
+
+		for (col = 0; col < cols; col++) {
+			bits = (uint16_t)(src[(uint16_t)sp * width + col] & mask) * mul;
+			if (GLCD_FB_IN_BAND(dp)) {
+				GLCD_Fb_Merge(&GLCD_Fb[dp - GLCD_FB_FIRST_PAGE][x + col], (uint8_t)bits, (uint8_t)masks, mode);
+			}
+			if ((uint8_t)(masks >> 8) && GLCD_FB_IN_BAND(dp + 1)) {
+				GLCD_Fb_Merge(&GLCD_Fb[dp + 1 - GLCD_FB_FIRST_PAGE][x + col], (uint8_t)(bits >> 8), (uint8_t)(masks >> 8), mode);
+			}
+		}
+		GLCD_Fb_MarkDirty(dp, x, x + cols - 1);
+		if ((uint8_t)(masks >> 8)) {
+			GLCD_Fb_MarkDirty(dp + 1, x, x + cols - 1);
+		}
+	}
+}
+
+uint8_t GLCD_Fb_DrawChar(const GLCD_FontType* font, char c, uint8_t x, uint8_t y, uint8_t mode)
+{
+	uint8_t glyph[GLCD_FONT_MAX_WIDTH * 3];
+	uint8_t width, height, spacing;
+
+	width = GLCD_Font_GetGlyph(font, c, glyph, sizeof(glyph), &height, &spacing);
+	if (width == 0) {
+		return 0;
+	}
+	GLCD_Fb_Blit(x, y, glyph, width, height, mode);
+	return width + spacing;
+}
+
+uint8_t GLCD_Fb_DrawString(const GLCD_FontType* font, const char* s, uint8_t x, uint8_t y, uint8_t mode)
+{
+	uint8_t start = x;
+
+	while (*s && x < 128) {
+		x += GLCD_Fb_DrawChar(font, *s++, x, y, mode);
+	}
+	return x - start;
+}
+
+#endif /* GLCD_FB_USED */
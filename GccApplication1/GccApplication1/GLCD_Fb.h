@@ -0,0 +1,53 @@
+/*
+ * GLCD_Fb.h
+ *
+ * Created: 19-Oct-26
+ *  Author: diaag
+ *
+ * SRAM framebuffer over a band of pages (GLCD_Fb_cfg.h). Drawing goes to the
+ * buffer at any pixel position and only the column span touched on each page
+ * is sent by GLCD_Fb_Flush, one GLCD_WriteRow burst per dirty page.
+ *
+ * Bitmaps and glyphs are page-major column bytes (as the fonts). Placed at a
+ * pixel row y that is not a multiple of 8, every source byte is split into
+ * the part for page y/8 and the part for the page below; both come from one
+ * 8x8 multiply by 1 << (y % 8), which the AVR does in a single MUL.
+ *
+ * The buffer is laid out in landscape pages; with GLCD_PORTRAIT the flush
+ * would clip it at 64 columns, so portrait drawing uses GLCD_Gfx bands.
+ */ 
+
+
+#ifndef GLCD_FB_H_
+#define GLCD_FB_H_
+
+#include <stdint.h>
+#include "GLCD_Fb_cfg.h"
+#include "GLCD_Font.h"
+
+/* Raster modes */
+#define GLCD_FB_SET		(0u)	/* Source replaces the covered rows */
+#define GLCD_FB_OR		(1u)	/* Source pixels are set, others kept */
+#define GLCD_FB_XOR		(2u)	/* Source pixels are inverted */
+#define GLCD_FB_CLEAR	(3u)	/* Source pixels are cleared */
+
+extern uint8_t GLCD_Fb[GLCD_FB_PAGES][128];
+
+/* Clears the buffer and marks it dirty, also the initialization before the first drawing */
+extern void GLCD_Fb_Clear(void);
+
+/* Marks columns x0..x1 of a screen page as changed */
+extern void GLCD_Fb_MarkDirty(uint8_t page, uint8_t x0, uint8_t x1);
+
+/* Sends the changed spans to the display */
+extern void GLCD_Fb_Flush(void);
+
+/* Draws a width x height page-major bitmap with its top left pixel at x, y; clipped to the band */
+extern void GLCD_Fb_Blit(uint8_t x, uint8_t y, const uint8_t* src, uint8_t width, uint8_t height, uint8_t mode);
+
+/* Draws a character / RAM string of a font with its top at pixel row y, returns the columns used */
+extern uint8_t GLCD_Fb_DrawChar(const GLCD_FontType* font, char c, uint8_t x, uint8_t y, uint8_t mode);
+extern uint8_t GLCD_Fb_DrawString(const GLCD_FontType* font, const char* s, uint8_t x, uint8_t y, uint8_t mode);
+
+
+#endif /* GLCD_FB_H_ */
@@ -0,0 +1,20 @@
+/*
+ * GLCD_Fb_cfg.h
+ *
+ * Created: 19-Oct-26
+ *  Author: diaag
+ */ 
+
+
+#ifndef GLCD_FB_CFG_H_
+#define GLCD_FB_CFG_H_
+
+/* Framebuffer built in (1u) or left out (0u), it takes GLCD_FB_PAGES x 128 bytes of SRAM */
+#define GLCD_FB_USED		(0u)
+
+/* Pages held in SRAM: 128 bytes each, 8 pages = the whole screen (1 KB) */
+#define GLCD_FB_FIRST_PAGE	(0u)
+#define GLCD_FB_PAGES		(8u)
+
+
+#endif /* GLCD_FB_CFG_H_ */
@@ -0,0 +1,67 @@
+/*
+ * GLCD_Field.c
+ *
+ * Created: 19-Oct-26
+ *  Author: diaag
+ */ 
+
+#include <stdint-gcc.h>
+
+#include "GLCD.h"
+#include "GLCD_Field.h"
+
+void GLCD_Field_Init(GLCD_FieldType* field, uint8_t page, uint8_t col, uint8_t width)
+{
+	uint8_t fit = (col < GLCD_WIDTH) ? (uint8_t)((GLCD_WIDTH - col + 4) / 5) : 0;
+
+	if (width > GLCD_FIELD_MAX_CHARS) {
+		width = GLCD_FIELD_MAX_CHARS;
+	}
+	if (width > fit) {
+		width = fit;
+	}
+	field->Page = page;
+	field->Col = col;
+	field->Width = width;
+	GLCD_Field_Invalidate(field);
+}
+
+void GLCD_Field_Invalidate(GLCD_FieldType* field)
+{
+	uint8_t i;
+
+	/* No text character is 0xFF, so every position differs on the next update */
+	for (i = 0; i < field->Width; i++) {
+		field->Shown[i] = (char)0xFF;
+	}
+}
+
+void GLCD_Field_Update(GLCD_FieldType* field, const char* text)
+{
+	uint8_t i = 0, start;
+	char next[GLCD_FIELD_MAX_CHARS];
+	uint8_t ended = 0;
+
+	for (i = 0; i < field->Width; i++) {
+		if (!ended && text[i] == '\0') {
+			ended = 1;
+		}
+		next[i] = ended ? ' ' : text[i];
+	}
+
+	i = 0;
+	while (i < field->Width)
+	{
+		if (next[i] == field->Shown[i]) {
+			i++;
+			continue;
+		}
+		/* Run of changed characters, drawn with one cursor set */
+		start = i;
+		while (i < field->Width && next[i] != field->Shown[i]) {
+			field->Shown[i] = next[i];
+			i++;
+		}
+		GLCD_PrintText(&next[start], i - start, field->Page, field->Col + start * 5);
+	}
+}
@@ -0,0 +1,38 @@
+/*
+ * GLCD_Field.h
+ *
+ * Created: 19-Oct-26
+ *  Author: diaag
+ *
+ * Text field widget. A field is bound to a page and a column range and keeps
+ * the characters it has drawn; an update compares the new text character by
+ * character and only resends the glyphs that changed, one cursor set per run
+ * of adjacent changed characters.
+ */ 
+
+
+#ifndef GLCD_FIELD_H_
+#define GLCD_FIELD_H_
+
+#include <stdint.h>
+
+#define GLCD_FIELD_MAX_CHARS	(25u)	/* 128 columns / 5 column glyphs */
+
+typedef struct {
+	uint8_t Page;		/* Page (text row) of the field */
+	uint8_t Col;		/* First column of the field */
+	uint8_t Width;		/* Field width in characters */
+	char Shown[GLCD_FIELD_MAX_CHARS];	/* Characters currently on the display */
+} GLCD_FieldType;
+
+/* Binds the field to page/col, width is clipped to the screen; the next update draws every character */
+extern void GLCD_Field_Init(GLCD_FieldType* field, uint8_t page, uint8_t col, uint8_t width);
+
+/* Forgets the drawn characters, e.g. after GLCD_ClearAll */
+extern void GLCD_Field_Invalidate(GLCD_FieldType* field);
+
+/* Shows text left aligned, characters past its end are blanked */
+extern void GLCD_Field_Update(GLCD_FieldType* field, const char* text);
+
+
+#endif /* GLCD_FIELD_H_ */
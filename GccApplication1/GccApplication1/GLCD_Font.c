@@ -0,0 +1,361 @@
+/*
+ * GLCD_Font.c
+ *
+ * Created: 19-Oct-26
+ *  Author: diaag
+ */ 
+
+#include <stdint.h>
+#include <avr/pgmspace.h>
+
+#include "GLCD.h"
+#include "GLCD_Font.h"
+
+/* Glyph stream decoder, keeps the RLE state between the pages of a glyph */
+typedef struct {
+	const uint8_t* Src;
+	uint8_t Count;		/* Bytes left in the current literal or run */
+	uint8_t Run;		/* Nonzero while repeating Value */
+	uint8_t Value;
+} GLCD_Font_DecoderType;
+
+static void GLCD_Font_Load(const GLCD_FontType* font, GLCD_FontType* f)
+{
+	memcpy_P(f, font, sizeof(GLCD_FontType));
+}
+
+static uint8_t GLCD_Font_PagesOf(const GLCD_FontType* f)
+{
+	return (uint8_t)((f->Height + 7) / 8);
+}
+
+/* Points the decoder at glyph c, returns its width (0 when missing) */
+static uint8_t GLCD_Font_Locate(const GLCD_FontType* f, char c, GLCD_Font_DecoderType* dec)
+{
+	uint8_t code = (uint8_t)c, index;
+	uint16_t offset, next;
+
+	dec->Count = 0;
+	dec->Run = 0;
+	if (code < f->First || code > f->Last) {
+		return 0;
+	}
+	index = code - f->First;
+
+	if (f->Offsets == 0) {
+		dec->Src = f->Data + (uint16_t)index * f->Width * GLCD_Font_PagesOf(f);
+		return f->Width;
+	}
+
+	offset = pgm_read_word(&f->Offsets[index]);
+	next = pgm_read_word(&f->Offsets[index + 1]);
+	if (offset == next) {
+		return 0;
+	}
+	dec->Src = f->Data + offset + 1;
+	return pgm_read_byte(f->Data + offset);
+}
+
+/* Decodes the next n column bytes of the glyph */
+static void GLCD_Font_Decode(GLCD_Font_DecoderType* dec, uint8_t rle, uint8_t* out, uint8_t n)
+{
+	uint8_t control;
+
+	if (!rle) {
+		while (n--) {
+			*out++ = pgm_read_byte(dec->Src++);
+		}
+		return;
+	}
+	while (n--) {
+		if (dec->Count == 0) {
+			control = pgm_read_byte(dec->Src++);
+			dec->Count = (control & 0x7F) + 1;
+			dec->Run = control & 0x80;
+			if (dec->Run) {
+				dec->Value = pgm_read_byte(dec->Src++);
+			}
+		}
+		*out++ = dec->Run ? dec->Value : pgm_read_byte(dec->Src++);
+		dec->Count--;
+	}
+}
+
+/* Skips the next n column bytes of the glyph */
+static void GLCD_Font_Skip(GLCD_Font_DecoderType* dec, uint8_t rle, uint8_t n)
+{
+	uint8_t control;
+
+	if (!rle) {
+		dec->Src += n;
+		return;
+	}
+	while (n != 0) {
+		if (dec->Count == 0) {
+			control = pgm_read_byte(dec->Src++);
+			dec->Count = (control & 0x7F) + 1;
+			dec->Run = control & 0x80;
+			if (dec->Run) {
+				dec->Value = pgm_read_byte(dec->Src++);
+			}
+		}
+		/* Whole literals and runs are stepped over at once */
+		control = (n < dec->Count) ? n : dec->Count;
+		if (!dec->Run) {
+			dec->Src += control;
+		}
+		dec->Count -= control;
+		n -= control;
+	}
+}
+
+uint8_t GLCD_Font_Pages(const GLCD_FontType* font)
+{
+	GLCD_FontType f;
+	GLCD_Font_Load(font, &f);
+	return GLCD_Font_PagesOf(&f);
+}
+
+uint8_t GLCD_Font_CharWidth(const GLCD_FontType* font, char c)
+{
+	GLCD_FontType f;
+	GLCD_Font_DecoderType dec;
+	GLCD_Font_Load(font, &f);
+	return GLCD_Font_Locate(&f, c, &dec);
+}
+
+/* Draws c padded with blank columns to at least cell columns, a missing glyph with cell 0 draws nothing */
+static uint8_t GLCD_Font_Draw(const GLCD_FontType* f, char c, uint8_t page, uint8_t col, uint8_t cell)
+{
+	uint8_t row[GLCD_FONT_MAX_WIDTH];
+	GLCD_Font_DecoderType dec;
+	uint8_t width, total, p, i, pages = GLCD_Font_PagesOf(f);
+
+	width = GLCD_Font_Locate(f, c, &dec);
+	if (width > GLCD_FONT_MAX_WIDTH) {
+		width = 0;
+	}
+	total = (width != 0) ? width + f->Spacing : 0;
+	if (total < cell) {
+		total = cell;
+	}
+	if (total == 0) {
+		return 0;
+	}
+	if (total > GLCD_FONT_MAX_WIDTH) {
+		total = GLCD_FONT_MAX_WIDTH;
+	}
+	for (i = width; i < total; i++) {
+		row[i] = 0x00;
+	}
+
+	for (p = 0; p < pages; p++) {
+		GLCD_Font_Decode(&dec, (f->Offsets != 0) && (f->Flags & GLCD_FONT_RLE), row, width);
+		if (page + p < GLCD_PAGES) {
+			GLCD_WriteRow(page + p, col, row, total);
+		}
+	}
+	return total;
+}
+
+uint8_t GLCD_Font_GetGlyph(const GLCD_FontType* font, char c, uint8_t* out, uint16_t size, uint8_t* height, uint8_t* spacing)
+{
+	GLCD_FontType f;
+	GLCD_Font_DecoderType dec;
+	uint8_t width, pages;
+
+	GLCD_Font_Load(font, &f);
+	pages = GLCD_Font_PagesOf(&f);
+	width = GLCD_Font_Locate(&f, c, &dec);
+	if (width == 0 || (uint16_t)width * pages > size) {
+		return 0;
+	}
+	GLCD_Font_Decode(&dec, (f.Offsets != 0) && (f.Flags & GLCD_FONT_RLE), out, (uint8_t)(width * pages));
+	*height = f.Height;
+	*spacing = f.Spacing;
+	return width;
+}
+
+uint8_t GLCD_Font_DrawChar(const GLCD_FontType* font, char c, uint8_t page, uint8_t col)
+{
+	GLCD_FontType f;
+	GLCD_Font_Load(font, &f);
+	return GLCD_Font_Draw(&f, c, page, col, 0);
+}
+
+uint8_t GLCD_Font_DrawCell(const GLCD_FontType* font, char c, uint8_t page, uint8_t col, uint8_t cell)
+{
+	GLCD_FontType f;
+	GLCD_Font_Load(font, &f);
+	return GLCD_Font_Draw(&f, c, page, col, cell);
+}
+
+uint8_t GLCD_Font_DrawString(const GLCD_FontType* font, const char* s, uint8_t page, uint8_t col)
+{
+	GLCD_FontType f;
+	GLCD_Font_Load(font, &f);
+	while (*s && col < GLCD_WIDTH) {
+		col += GLCD_Font_Draw(&f, *s++, page, col, 0);
+	}
+	return col;
+}
+
+uint8_t GLCD_Font_DrawString_P(const GLCD_FontType* font, const char* s, uint8_t page, uint8_t col)
+{
+	GLCD_FontType f;
+	char c;
+	GLCD_Font_Load(font, &f);
+	while ((c = pgm_read_byte(s++)) && col < GLCD_WIDTH) {
+		col += GLCD_Font_Draw(&f, c, page, col, 0);
+	}
+	return col;
+}
+
+uint8_t GLCD_Font_StringWidth(const GLCD_FontType* font, const char* s)
+{
+	GLCD_FontType f;
+	GLCD_Font_DecoderType dec;
+	uint8_t width, total = 0;
+	GLCD_Font_Load(font, &f);
+	while (*s) {
+		width = GLCD_Font_Locate(&f, *s++, &dec);
+		if (width != 0) {
+			total += width + f.Spacing;
+		}
+	}
+	return total;
+}
+
+uint8_t GLCD_Font_StringWidth_P(const GLCD_FontType* font, const char* s)
+{
+	GLCD_FontType f;
+	GLCD_Font_DecoderType dec;
+	uint8_t width, total = 0;
+	char c;
+	GLCD_Font_Load(font, &f);
+	while ((c = pgm_read_byte(s++))) {
+		width = GLCD_Font_Locate(&f, c, &dec);
+		if (width != 0) {
+			total += width + f.Spacing;
+		}
+	}
+	return total;
+}
+
+uint8_t GLCD_Font_Layout(GLCD_FontRunType* run, const GLCD_FontType* font, const char* s)
+{
+	GLCD_Font_DecoderType dec;
+	uint8_t width;
+
+	GLCD_Font_Load(font, &run->Font);
+	run->Count = 0;
+	run->Width = 0;
+	while (*s && run->Count < GLCD_FONT_MAX_RUN && run->Width < GLCD_WIDTH) {
+		width = GLCD_Font_Locate(&run->Font, *s++, &dec);
+		if (width == 0 || width > GLCD_FONT_MAX_WIDTH) {
+			continue;
+		}
+		run->Glyphs[run->Count].Src = dec.Src;
+		run->Glyphs[run->Count].Width = width;
+		run->Count++;
+		run->Width += width + run->Font.Spacing;
+	}
+	return run->Width;
+}
+
+uint8_t GLCD_Font_DrawRun(const GLCD_FontRunType* run, uint8_t page, uint8_t col)
+{
+	uint8_t row[128];
+	GLCD_Font_DecoderType dec[GLCD_FONT_MAX_RUN];
+	uint8_t rle = (run->Font.Offsets != 0) && (run->Font.Flags & GLCD_FONT_RLE);
+	uint8_t pages = GLCD_Font_PagesOf(&run->Font);
+	uint8_t len = (col < GLCD_WIDTH) ? (uint8_t)(GLCD_WIDTH - col) : 0;
+	uint8_t g, p, i, x, width;
+
+	if (len > run->Width) {
+		len = run->Width;
+	}
+	for (g = 0; g < run->Count; g++) {
+		dec[g].Src = run->Glyphs[g].Src;
+		dec[g].Count = 0;
+		dec[g].Run = 0;
+	}
+
+	for (p = 0; p < pages; p++)
+	{
+		/* Every glyph continues its own decoder, so each page is decoded once */
+		x = 0;
+		for (g = 0; g < run->Count && x < len; g++) {
+			width = run->Glyphs[g].Width;
+			if (x + width <= len) {
+				GLCD_Font_Decode(&dec[g], rle, &row[x], width);
+			} else {
+				uint8_t tmp[GLCD_FONT_MAX_WIDTH];
+				GLCD_Font_Decode(&dec[g], rle, tmp, width);
+				for (i = 0; x + i < len; i++) {
+					row[x + i] = tmp[i];
+				}
+			}
+			x += width;
+			for (i = 0; i < run->Font.Spacing && x < len; i++) {
+				row[x++] = 0x00;
+			}
+		}
+		if (page + p < GLCD_PAGES && len != 0) {
+			GLCD_WriteRow(page + p, col, row, len);
+		}
+	}
+	return col + len;
+}
+
+/* Page p of every glyph of s into out, the earlier pages are skipped and the later ones never decoded */
+static uint8_t GLCD_Font_Page(const GLCD_FontType* font, const char* s, uint8_t flash, uint8_t p, uint8_t cell, uint8_t* out, uint8_t len)
+{
+	GLCD_FontType f;
+	GLCD_Font_DecoderType dec;
+	uint8_t tmp[GLCD_FONT_MAX_WIDTH];
+	uint8_t rle, width, x = 0, i;
+	char c;
+
+	GLCD_Font_Load(font, &f);
+	if (p >= GLCD_Font_PagesOf(&f)) {
+		return 0;
+	}
+	rle = (f.Offsets != 0) && (f.Flags & GLCD_FONT_RLE);
+
+	while (x < len && (c = flash ? (char)pgm_read_byte(s) : *s) != '\0')
+	{
+		s++;
+		width = GLCD_Font_Locate(&f, c, &dec);
+		if (width > GLCD_FONT_MAX_WIDTH) {
+			width = 0;
+		}
+		if (width != 0) {
+			GLCD_Font_Skip(&dec, rle, (uint8_t)(p * width));
+			if (x + width <= len) {
+				GLCD_Font_Decode(&dec, rle, &out[x], width);
+			} else {
+				GLCD_Font_Decode(&dec, rle, tmp, width);
+				for (i = 0; x + i < len; i++) {
+					out[x + i] = tmp[i];
+				}
+			}
+		}
+		if (cell != 0) {
+			x = (x + cell < len) ? (uint8_t)(x + cell) : len;
+		} else if (width != 0) {
+			x = (x + width + f.Spacing < len) ? (uint8_t)(x + width + f.Spacing) : len;
+		}
+	}
+	return x;
+}
+
+uint8_t GLCD_Font_RenderPage(const GLCD_FontType* font, const char* s, uint8_t p, uint8_t cell, uint8_t* out, uint8_t len)
+{
+	return GLCD_Font_Page(font, s, 0, p, cell, out, len);
+}
+
+uint8_t GLCD_Font_RenderPage_P(const GLCD_FontType* font, const char* s, uint8_t p, uint8_t cell, uint8_t* out, uint8_t len)
+{
+	return GLCD_Font_Page(font, s, 1, p, cell, out, len);
+}
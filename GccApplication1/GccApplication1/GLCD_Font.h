@@ -0,0 +1,99 @@
+/*
+ * GLCD_Font.h
+ *
+ * Created: 19-Oct-26
+ *  Author: diaag
+ *
+ * Font subsystem. A font is a descriptor in program memory pointing to glyph
+ * data in program memory. Glyph columns are stored page-major: all columns of
+ * the top page, then all columns of the next page, so each page of a glyph is
+ * decoded into a row buffer and sent with one GLCD_WriteRow burst.
+ *
+ * Two layouts are supported:
+ *  - Fixed (Offsets == 0): every glyph First..Last is Width * pages raw bytes,
+ *    glyph i starts at i * Width * pages.
+ *  - Indexed: Offsets holds Last - First + 2 byte offsets into Data. A glyph
+ *    whose offset equals the next one is missing (sparse ranges cost 2 bytes
+ *    per unused code) and draws nothing. Each glyph starts with its width
+ *    byte, followed by width * pages column bytes, raw or column-RLE coded
+ *    when GLCD_FONT_RLE is set.
+ *
+ * Column-RLE: a control byte n < 0x80 is followed by n + 1 literal bytes,
+ * n >= 0x80 by one byte repeated (n & 0x7F) + 1 times. Runs may continue
+ * across page boundaries of the same glyph.
+ */ 
+
+
+#ifndef GLCD_FONT_H_
+#define GLCD_FONT_H_
+
+#include <stdint.h>
+
+#define GLCD_FONT_RLE		(0x01u)	/* Indexed glyph data is column-RLE coded */
+
+#define GLCD_FONT_MAX_WIDTH	(32u)	/* Widest glyph plus spacing, size of the row buffer */
+#define GLCD_FONT_MAX_RUN	(24u)	/* Glyphs of a laid out run */
+
+typedef struct {
+	uint8_t Width;			/* Glyph width of a fixed font, widest glyph of an indexed font */
+	uint8_t Height;			/* Glyph height in pixels, pages = (Height + 7) / 8 */
+	uint8_t First;			/* First character code */
+	uint8_t Last;			/* Last character code */
+	uint8_t Spacing;		/* Blank columns drawn after each glyph */
+	uint8_t Flags;			/* GLCD_FONT_xxx */
+	const uint16_t* Offsets;	/* Glyph offsets of an indexed font, 0 for a fixed font */
+	const uint8_t* Data;		/* Glyph data */
+} GLCD_FontType;
+
+/* One glyph of a run: start of its column data and its width */
+typedef struct {
+	const uint8_t* Src;
+	uint8_t Width;
+} GLCD_FontGlyphType;
+
+/* A string laid out once: measured, then drawn with one burst per page */
+typedef struct {
+	GLCD_FontType Font;		/* RAM copy of the descriptor */
+	uint8_t Count;			/* Glyphs in the run, missing glyphs are dropped */
+	uint8_t Width;			/* Columns of the run, spacing after each glyph included */
+	GLCD_FontGlyphType Glyphs[GLCD_FONT_MAX_RUN];
+} GLCD_FontRunType;
+
+/* Number of pages of the glyphs */
+extern uint8_t GLCD_Font_Pages(const GLCD_FontType* font);
+
+/* Width in columns of c, spacing excluded; 0 when the font has no glyph for c */
+extern uint8_t GLCD_Font_CharWidth(const GLCD_FontType* font, char c);
+
+/* Decodes glyph c page-major into out (size bytes), returns its width or 0; height and spacing of the font are returned too */
+extern uint8_t GLCD_Font_GetGlyph(const GLCD_FontType* font, char c, uint8_t* out, uint16_t size, uint8_t* height, uint8_t* spacing);
+
+/* Draws c with its top at page, returns the columns used (glyph plus spacing) */
+extern uint8_t GLCD_Font_DrawChar(const GLCD_FontType* font, char c, uint8_t page, uint8_t col);
+
+/* Draws c left aligned in a cell of at least cell columns, blanking the rest; a missing glyph clears the cell */
+extern uint8_t GLCD_Font_DrawCell(const GLCD_FontType* font, char c, uint8_t page, uint8_t col, uint8_t cell);
+
+/* Draws a RAM / program memory string, returns the column after the last glyph */
+extern uint8_t GLCD_Font_DrawString(const GLCD_FontType* font, const char* s, uint8_t page, uint8_t col);
+extern uint8_t GLCD_Font_DrawString_P(const GLCD_FontType* font, const char* s, uint8_t page, uint8_t col);
+
+
+/* Width in columns that GLCD_Font_DrawString would use for s, without drawing */
+extern uint8_t GLCD_Font_StringWidth(const GLCD_FontType* font, const char* s);
+extern uint8_t GLCD_Font_StringWidth_P(const GLCD_FontType* font, const char* s);
+
+/* Lays out up to GLCD_FONT_MAX_RUN glyphs of s, returns the run width (e.g. to right align) */
+extern uint8_t GLCD_Font_Layout(GLCD_FontRunType* run, const GLCD_FontType* font, const char* s);
+
+/* Draws a laid out run, one GLCD_WriteRow burst per page, returns the column after it */
+extern uint8_t GLCD_Font_DrawRun(const GLCD_FontRunType* run, uint8_t page, uint8_t col);
+
+
+/* Decodes page p of a RAM / program memory string into out[0..len-1] for a caller composing rows,
+ * glyphs start cell columns apart (0: glyph width plus spacing); blank columns are not written.
+ * Returns the columns used. */
+extern uint8_t GLCD_Font_RenderPage(const GLCD_FontType* font, const char* s, uint8_t p, uint8_t cell, uint8_t* out, uint8_t len);
+extern uint8_t GLCD_Font_RenderPage_P(const GLCD_FontType* font, const char* s, uint8_t p, uint8_t cell, uint8_t* out, uint8_t len);
+
+#endif /* GLCD_FONT_H_ */
@@ -0,0 +1,271 @@
+/*
+ * GLCD_Gfx.c
+ *
+ * Created: 19-Oct-26
+ *  Author: diaag
+ */ 
+
+#include <stdint.h>
+
+#include "GLCD.h"
+#include "LIB/BIT/Bit.h"
+#include "GLCD_Fb.h"
+#include "GLCD_Gfx.h"
+
+/* Last column and row in the current orientation, buffers keep a 128 byte stride */
+#define GLCD_GFX_XMAX	((int16_t)GLCD_WIDTH - 1)
+#define GLCD_GFX_YMAX	((int16_t)GLCD_HEIGHT - 1)
+
+/* Current target, Buffer 0 is the display */
+static uint8_t* GLCD_Gfx_Buffer;
+static uint8_t GLCD_Gfx_FirstPage;
+static uint8_t GLCD_Gfx_Pages = 8;
+static uint8_t GLCD_Gfx_TrackFb;
+
+static void GLCD_Gfx_Order(int16_t* a, int16_t* b)
+{
+	int16_t t;
+	if (*a > *b) {
+		t = *a; *a = *b; *b = t;
+	}
+}
+
+void GLCD_Gfx_UseBand(uint8_t* buffer, uint8_t firstPage, uint8_t pages)
+{
+	GLCD_Gfx_Buffer = buffer;
+	GLCD_Gfx_FirstPage = firstPage;
+	GLCD_Gfx_Pages = pages;
+	GLCD_Gfx_TrackFb = 0;
+}
+
+#if GLCD_FB_USED
+void GLCD_Gfx_UseFb(void)
+{
+	GLCD_Gfx_UseBand(&GLCD_Fb[0][0], GLCD_FB_FIRST_PAGE, GLCD_FB_PAGES);
+	GLCD_Gfx_TrackFb = 1;
+}
+#endif
+
+void GLCD_Gfx_UseBus(void)
+{
+	GLCD_Gfx_UseBand(0, 0, 16);	/* Enough pages for portrait */
+}
+
+void GLCD_Gfx_FlushBand(void)
+{
+	uint8_t p;
+
+	if (GLCD_Gfx_Buffer == 0) {
+		return;
+	}
+	for (p = 0; p < GLCD_Gfx_Pages; p++) {
+		GLCD_WriteRow(GLCD_Gfx_FirstPage + p, 0, &GLCD_Gfx_Buffer[(uint16_t)p * 128], GLCD_WIDTH);
+	}
+}
+
+void GLCD_Gfx_Span(uint8_t page, uint8_t x0, uint8_t x1, uint8_t mask, uint8_t mode)
+{
+	uint8_t row[128];
+	uint8_t* dst;
+	uint8_t n, i, p = page - GLCD_Gfx_FirstPage;
+
+	if (p >= GLCD_Gfx_Pages || x0 > x1 || x1 > GLCD_GFX_XMAX || mask == 0) {
+		return;
+	}
+	n = x1 - x0 + 1;
+
+	if (GLCD_Gfx_Buffer != 0) {
+		dst = &GLCD_Gfx_Buffer[(uint16_t)p * 128 + x0];
+#if GLCD_FB_USED
+		if (GLCD_Gfx_TrackFb) {
+			GLCD_Fb_MarkDirty(page, x0, x1);
+		}
+#endif
+	} else if (mask == 0xFF && mode != GLCD_PIXEL_XOR) {
+		/* Whole bytes are replaced, nothing to read */
+		for (i = 0; i < n; i++) row[i] = 0x00;
+		dst = row;
+	} else {
+		GLCD_ReadRow(page, x0, row, n);
+		dst = row;
+	}
+
+	switch (mode) {
+	case GLCD_PIXEL_SET:
+		for (i = 0; i < n; i++) dst[i] |= mask;
+		break;
+	case GLCD_PIXEL_CLEAR:
+		for (i = 0; i < n; i++) dst[i] &= (uint8_t)~mask;
+		break;
+	default:
+		for (i = 0; i < n; i++) dst[i] ^= mask;
+		break;
+	}
+
+	if (GLCD_Gfx_Buffer == 0) {
+		GLCD_WriteRow(page, x0, row, n);
+	}
+}
+
+/* Applies the rows y0..y1 to columns x0..x1, one span per page */
+static void GLCD_Gfx_Block(uint8_t x0, uint8_t x1, uint8_t y0, uint8_t y1, uint8_t mode)
+{
+	uint8_t page = y0 >> 3, last = y1 >> 3;
+	uint8_t mask;
+
+	for (; page <= last; page++) {
+		mask = 0xFF;
+		if (page == y0 >> 3) {
+			mask &= Bit_FromRow(y0);
+		}
+		if (page == last) {
+			mask &= Bit_ToRow(y1);
+		}
+		GLCD_Gfx_Span(page, x0, x1, mask, mode);
+	}
+}
+
+void GLCD_Gfx_Pixel(int16_t x, int16_t y, uint8_t mode)
+{
+	uint8_t* dst;
+	uint8_t p, bit;
+
+	if (x < 0 || x > GLCD_GFX_XMAX || y < 0 || y > GLCD_GFX_YMAX) {
+		return;
+	}
+	p = (uint8_t)(y >> 3) - GLCD_Gfx_FirstPage;
+	if (GLCD_Gfx_Buffer == 0 || GLCD_Gfx_TrackFb || p >= GLCD_Gfx_Pages) {
+		GLCD_Gfx_Span((uint8_t)(y >> 3), (uint8_t)x, (uint8_t)x, (uint8_t)(1u << (y & 7)), mode);
+		return;
+	}
+	/* Plain band: one byte, no span setup */
+	dst = &GLCD_Gfx_Buffer[(uint16_t)p * 128 + x];
+	bit = (uint8_t)(1u << (y & 7));
+	if (mode == GLCD_PIXEL_SET) {
+		*dst |= bit;
+	} else if (mode == GLCD_PIXEL_CLEAR) {
+		*dst &= (uint8_t)~bit;
+	} else {
+		*dst ^= bit;
+	}
+}
+
+void GLCD_Gfx_HLine(int16_t x0, int16_t x1, int16_t y, uint8_t mode)
+{
+	GLCD_Gfx_Order(&x0, &x1);
+	if (y < 0 || y > GLCD_GFX_YMAX || x1 < 0 || x0 > GLCD_GFX_XMAX) {
+		return;
+	}
+	if (x0 < 0) x0 = 0;
+	if (x1 > GLCD_GFX_XMAX) x1 = GLCD_GFX_XMAX;
+	GLCD_Gfx_Span((uint8_t)(y >> 3), (uint8_t)x0, (uint8_t)x1, (uint8_t)(1u << (y & 7)), mode);
+}
+
+void GLCD_Gfx_VLine(int16_t x, int16_t y0, int16_t y1, uint8_t mode)
+{
+	GLCD_Gfx_FillRect(x, y0, x, y1, mode);
+}
+
+void GLCD_Gfx_FillRect(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t mode)
+{
+	GLCD_Gfx_Order(&x0, &x1);
+	GLCD_Gfx_Order(&y0, &y1);
+	if (x1 < 0 || x0 > GLCD_GFX_XMAX || y1 < 0 || y0 > GLCD_GFX_YMAX) {
+		return;
+	}
+	if (x0 < 0) x0 = 0;
+	if (x1 > GLCD_GFX_XMAX) x1 = GLCD_GFX_XMAX;
+	if (y0 < 0) y0 = 0;
+	if (y1 > GLCD_GFX_YMAX) y1 = GLCD_GFX_YMAX;
+	GLCD_Gfx_Block((uint8_t)x0, (uint8_t)x1, (uint8_t)y0, (uint8_t)y1, mode);
+}
+
+void GLCD_Gfx_Rect(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t mode)
+{
+	GLCD_Gfx_Order(&x0, &x1);
+	GLCD_Gfx_Order(&y0, &y1);
+	GLCD_Gfx_HLine(x0, x1, y0, mode);
+	if (y1 != y0) {
+		GLCD_Gfx_HLine(x0, x1, y1, mode);
+	}
+	/* Sides without the corners, so XOR does not cancel them */
+	if (y1 - y0 > 1) {
+		GLCD_Gfx_VLine(x0, y0 + 1, y1 - 1, mode);
+		if (x1 != x0) {
+			GLCD_Gfx_VLine(x1, y0 + 1, y1 - 1, mode);
+		}
+	}
+}
+
+void GLCD_Gfx_Line(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t mode)
+{
+	int16_t dx, dy, sx, sy, err, e2;
+
+	if (y0 == y1) {
+		GLCD_Gfx_HLine(x0, x1, y0, mode);
+		return;
+	}
+	if (x0 == x1) {
+		GLCD_Gfx_VLine(x0, y0, y1, mode);
+		return;
+	}
+
+	/* Bresenham, all octants */
+	dx = (x1 > x0) ? x1 - x0 : x0 - x1;
+	dy = (y1 > y0) ? y0 - y1 : y1 - y0;
+	sx = (x0 < x1) ? 1 : -1;
+	sy = (y0 < y1) ? 1 : -1;
+	err = dx + dy;
+	for (;;) {
+		GLCD_Gfx_Pixel(x0, y0, mode);
+		if (x0 == x1 && y0 == y1) {
+			break;
+		}
+		e2 = 2 * err;
+		if (e2 >= dy) {
+			err += dy;
+			x0 += sx;
+		}
+		if (e2 <= dx) {
+			err += dx;
+			y0 += sy;
+		}
+	}
+}
+
+void GLCD_Gfx_Circle(int16_t cx, int16_t cy, int16_t r, uint8_t mode)
+{
+	int16_t x = r, y = 0, err = 1 - r;
+
+	if (r < 0) {
+		return;
+	}
+	if (r == 0) {
+		GLCD_Gfx_Pixel(cx, cy, mode);
+		return;
+	}
+	/* Midpoint circle, one octant mirrored eight ways; the points on the axes and diagonals are drawn once */
+	while (x >= y) {
+		GLCD_Gfx_Pixel(cx + x, cy + y, mode);
+		GLCD_Gfx_Pixel(cx - x, cy - y, mode);
+		if (y != 0) {
+			GLCD_Gfx_Pixel(cx + x, cy - y, mode);
+			GLCD_Gfx_Pixel(cx - x, cy + y, mode);
+		}
+		if (x != y) {
+			GLCD_Gfx_Pixel(cx + y, cy + x, mode);
+			GLCD_Gfx_Pixel(cx - y, cy - x, mode);
+			if (y != 0) {
+				GLCD_Gfx_Pixel(cx - y, cy + x, mode);
+				GLCD_Gfx_Pixel(cx + y, cy - x, mode);
+			}
+		}
+		y++;
+		if (err < 0) {
+			err += 2 * y + 1;
+		} else {
+			x--;
+			err += 2 * (y - x) + 1;
+		}
+	}
+}
@@ -0,0 +1,54 @@
+/*
+ * GLCD_Gfx.h
+ *
+ * Created: 19-Oct-26
+ *  Author: diaag
+ *
+ * Graphics primitives on the page-major display memory. Everything is drawn
+ * through one span kernel that applies a byte mask (the pixel rows inside a
+ * page) to a run of columns of one page: a horizontal line or a filled
+ * rectangle costs one masked byte per column and page, a vertical line one
+ * precomputed mask per page.
+ *
+ * The kernel writes to the current target:
+ *  - a RAM buffer of whole pages: the framebuffer (GLCD_Gfx_UseFb, with its
+ *    dirty tracking) or a caller band of a few pages that is drawn, sent with
+ *    GLCD_Gfx_FlushBand and moved down the screen;
+ *  - the display itself (GLCD_Gfx_UseBus), read-modify-write over the bus.
+ * Pixels outside the target are clipped.
+ */ 
+
+
+#ifndef GLCD_GFX_H_
+#define GLCD_GFX_H_
+
+#include <stdint.h>
+#include "GLCD.h"
+
+/* Drawing modes are GLCD_PIXEL_SET, GLCD_PIXEL_CLEAR and GLCD_PIXEL_XOR of GLCD.h */
+
+/* Draws into buffer, pages x 128 bytes holding screen pages firstPage.. */
+extern void GLCD_Gfx_UseBand(uint8_t* buffer, uint8_t firstPage, uint8_t pages);
+
+/* Draws into the framebuffer of GLCD_Fb (GLCD_FB_USED), send it with GLCD_Fb_Flush */
+extern void GLCD_Gfx_UseFb(void);
+
+/* Draws straight on the display */
+extern void GLCD_Gfx_UseBus(void);
+
+/* Sends the pages of the current band to the display */
+extern void GLCD_Gfx_FlushBand(void);
+
+/* Applies mask to columns x0..x1 (inclusive) of a screen page, the span kernel */
+extern void GLCD_Gfx_Span(uint8_t page, uint8_t x0, uint8_t x1, uint8_t mask, uint8_t mode);
+
+extern void GLCD_Gfx_Pixel(int16_t x, int16_t y, uint8_t mode);
+extern void GLCD_Gfx_HLine(int16_t x0, int16_t x1, int16_t y, uint8_t mode);
+extern void GLCD_Gfx_VLine(int16_t x, int16_t y0, int16_t y1, uint8_t mode);
+extern void GLCD_Gfx_Line(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t mode);
+extern void GLCD_Gfx_Rect(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t mode);
+extern void GLCD_Gfx_FillRect(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t mode);
+extern void GLCD_Gfx_Circle(int16_t cx, int16_t cy, int16_t r, uint8_t mode);
+
+
+#endif /* GLCD_GFX_H_ */
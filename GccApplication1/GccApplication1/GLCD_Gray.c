@@ -0,0 +1,327 @@
+/*
+ * GLCD_Gray.c
+ *
+ * Created: 19-Oct-26
+ *  Author: diaag
+ */ 
+
+#include <stdint.h>
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#ifndef F_CPU
+#define F_CPU 8000000UL
+#endif
+
+#include "GLCD.h"
+#include "LIB/BIT/Bit.h"
+#include "GLCD_Gray_cfg.h"
+#include "GLCD_Gray.h"
+
+#if GLCD_GRAY_USED
+
+#include "MCAL/PWM/Pwm_Cfg.h"
+
+#if PWM_TIMER0_USED
+#error "GLCD_Gray needs Timer0, disable the OC0 PWM channel"
+#endif
+
+#if GLCD_GRAY_PRESCALER == 8u
+#define GLCD_GRAY_CS		(2u)
+#elif GLCD_GRAY_PRESCALER == 64u
+#define GLCD_GRAY_CS		(3u)
+#elif GLCD_GRAY_PRESCALER == 256u
+#define GLCD_GRAY_CS		(4u)
+#elif GLCD_GRAY_PRESCALER == 1024u
+#define GLCD_GRAY_CS		(5u)
+#else
+#error "GLCD_GRAY_PRESCALER must be 8, 64, 256 or 1024"
+#endif
+
+#define GLCD_GRAY_OCR		(F_CPU / GLCD_GRAY_PRESCALER / GLCD_GRAY_FRAME_HZ - 1u)
+
+#if (GLCD_GRAY_OCR < 1u) || (GLCD_GRAY_OCR > 255u)
+#error "GLCD_GRAY_FRAME_HZ out of the Timer0 range for GLCD_GRAY_PRESCALER"
+#endif
+
+#if GLCD_GRAY_FIRST_PAGE + GLCD_GRAY_PAGES > 8u
+#error "Gray band beyond page 7"
+#endif
+
+/* Frames per cycle: plane 1 in frames 0 and 1, plane 0 in frame 2 */
+#define GLCD_GRAY_FRAMES	(3u)
+
+uint8_t GLCD_Gray_Plane[2][GLCD_GRAY_PAGES][128];
+
+/* Column spans per page, empty when Min > Max. Dirty is drawing not yet committed,
+ * Sync and Differ belong to the ISR once committed. */
+static uint8_t GLCD_Gray_DirtyMin[GLCD_GRAY_PAGES], GLCD_Gray_DirtyMax[GLCD_GRAY_PAGES];
+static volatile uint8_t GLCD_Gray_SyncMin[GLCD_GRAY_PAGES], GLCD_Gray_SyncMax[GLCD_GRAY_PAGES];
+static volatile uint8_t GLCD_Gray_DiffMin[GLCD_GRAY_PAGES], GLCD_Gray_DiffMax[GLCD_GRAY_PAGES];
+
+static volatile uint8_t GLCD_Gray_Frame;
+static volatile uint8_t GLCD_Gray_Shown;
+static volatile uint8_t GLCD_Gray_Locked;
+static volatile uint8_t GLCD_Gray_Pending;
+
+/* Sends the columns of plane that changed since the other plane was shown */
+static void GLCD_Gray_Flush(uint8_t plane)
+{
+	uint8_t p, x0, x1;
+
+	for (p = 0; p < GLCD_GRAY_PAGES; p++)
+	{
+		x0 = GLCD_Gray_DiffMin[p];
+		x1 = GLCD_Gray_DiffMax[p];
+		if (GLCD_Gray_SyncMin[p] <= GLCD_Gray_SyncMax[p])
+		{
+			if (x0 > x1) {
+				x0 = GLCD_Gray_SyncMin[p];
+				x1 = GLCD_Gray_SyncMax[p];
+			} else {
+				if (GLCD_Gray_SyncMin[p] < x0) x0 = GLCD_Gray_SyncMin[p];
+				if (GLCD_Gray_SyncMax[p] > x1) x1 = GLCD_Gray_SyncMax[p];
+			}
+			GLCD_Gray_SyncMin[p] = 0xFF;
+			GLCD_Gray_SyncMax[p] = 0x00;
+		}
+		if (x0 <= x1) {
+			GLCD_WriteRow(GLCD_GRAY_FIRST_PAGE + p, x0, &GLCD_Gray_Plane[plane][p][x0], x1 - x0 + 1);
+		}
+	}
+	GLCD_Gray_Shown = plane;
+}
+
+static void GLCD_Gray_Span(uint8_t* min, uint8_t* max, uint8_t x0, uint8_t x1)
+{
+	if (*min > *max) {
+		*min = x0;
+		*max = x1;
+		return;
+	}
+	if (x0 < *min) *min = x0;
+	if (x1 > *max) *max = x1;
+}
+
+void GLCD_Gray_Init(void)
+{
+	uint8_t p, x;
+
+	TIMSK &= (uint8_t)~(1u << OCIE0);
+	for (p = 0; p < GLCD_GRAY_PAGES; p++) {
+		for (x = 0; x < 128; x++) {
+			GLCD_Gray_Plane[0][p][x] = 0x00;
+			GLCD_Gray_Plane[1][p][x] = 0x00;
+		}
+		GLCD_Gray_DirtyMin[p] = 0;
+		GLCD_Gray_DirtyMax[p] = 127;
+		GLCD_Gray_SyncMin[p] = 0xFF;
+		GLCD_Gray_SyncMax[p] = 0x00;
+		GLCD_Gray_DiffMin[p] = 0xFF;
+		GLCD_Gray_DiffMax[p] = 0x00;
+	}
+	GLCD_Gray_Frame = 0;
+	GLCD_Gray_Shown = 0;
+	GLCD_Gray_Locked = 0;
+	GLCD_Gray_Pending = 0;
+	GLCD_Gray_Commit();
+
+	TCNT0 = 0;
+	OCR0 = (uint8_t)GLCD_GRAY_OCR;
+	TCCR0 = (1u << WGM01) | GLCD_GRAY_CS;	/* CTC */
+	TIMSK |= (1u << OCIE0);
+}
+
+void GLCD_Gray_Stop(void)
+{
+	TIMSK &= (uint8_t)~(1u << OCIE0);
+	TCCR0 = 0;
+	GLCD_Gray_Pending = 0;
+}
+
+void GLCD_Gray_MarkDirty(uint8_t page, uint8_t x0, uint8_t x1)
+{
+	uint8_t p = page - GLCD_GRAY_FIRST_PAGE;
+
+	if (p >= GLCD_GRAY_PAGES || x0 > x1 || x1 > 127) {
+		return;
+	}
+	GLCD_Gray_Span(&GLCD_Gray_DirtyMin[p], &GLCD_Gray_DirtyMax[p], x0, x1);
+}
+
+void GLCD_Gray_Invalidate(void)
+{
+	uint8_t p;
+
+	for (p = 0; p < GLCD_GRAY_PAGES; p++) {
+		GLCD_Gray_DirtyMin[p] = 0;
+		GLCD_Gray_DirtyMax[p] = 127;
+	}
+}
+
+void GLCD_Gray_FillRect(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, uint8_t level)
+{
+	uint8_t page, last, mask, x, p;
+	uint8_t* hi;
+	uint8_t* lo;
+
+	if (x0 > x1 || y0 > y1 || x1 > 127) {
+		return;
+	}
+	last = y1 >> 3;
+	for (page = y0 >> 3; page <= last; page++)
+	{
+		p = page - GLCD_GRAY_FIRST_PAGE;
+		if (p >= GLCD_GRAY_PAGES) {
+			continue;
+		}
+		mask = 0xFF;
+		if (page == y0 >> 3) {
+			mask &= Bit_FromRow(y0);
+		}
+		if (page == last) {
+			mask &= Bit_ToRow(y1);
+		}
+		hi = &GLCD_Gray_Plane[1][p][0];
+		lo = &GLCD_Gray_Plane[0][p][0];
+		for (x = x0; x <= x1; x++)
+		{
+			hi[x] = (level & 2u) ? (hi[x] | mask) : (hi[x] & (uint8_t)~mask);
+			lo[x] = (level & 1u) ? (lo[x] | mask) : (lo[x] & (uint8_t)~mask);
+			if (x == 127) {
+				break;
+			}
+		}
+		GLCD_Gray_Span(&GLCD_Gray_DirtyMin[p], &GLCD_Gray_DirtyMax[p], x0, x1);
+	}
+}
+
+void GLCD_Gray_Commit(void)
+{
+	uint8_t diffMin[GLCD_GRAY_PAGES], diffMax[GLCD_GRAY_PAGES];
+	uint8_t p, x, sreg;
+
+	for (p = 0; p < GLCD_GRAY_PAGES; p++)
+	{
+		diffMin[p] = 0xFF;
+		diffMax[p] = 0x00;
+		for (x = 0; x < 128; x++) {
+			if (GLCD_Gray_Plane[0][p][x] != GLCD_Gray_Plane[1][p][x]) {
+				if (diffMin[p] == 0xFF) diffMin[p] = x;
+				diffMax[p] = x;
+			}
+		}
+	}
+
+	sreg = SREG;
+	cli();
+	for (p = 0; p < GLCD_GRAY_PAGES; p++)
+	{
+		GLCD_Gray_DiffMin[p] = diffMin[p];
+		GLCD_Gray_DiffMax[p] = diffMax[p];
+		if (GLCD_Gray_DirtyMin[p] <= GLCD_Gray_DirtyMax[p]) {
+			GLCD_Gray_Span((uint8_t*)&GLCD_Gray_SyncMin[p], (uint8_t*)&GLCD_Gray_SyncMax[p],
+			               GLCD_Gray_DirtyMin[p], GLCD_Gray_DirtyMax[p]);
+		}
+		GLCD_Gray_DirtyMin[p] = 0xFF;
+		GLCD_Gray_DirtyMax[p] = 0x00;
+	}
+	SREG = sreg;
+}
+
+void GLCD_Gray_Lock(void)
+{
+	uint8_t sreg = SREG;
+	cli();
+	GLCD_Gray_Locked++;
+	SREG = sreg;
+}
+
+void GLCD_Gray_Unlock(void)
+{
+	uint8_t sreg = SREG;
+	uint8_t plane;
+
+	cli();
+	if (GLCD_Gray_Locked == 1 && GLCD_Gray_Pending)
+	{
+		/* A switch came during the lock: do it now, still locked against the ISR */
+		GLCD_Gray_Pending = 0;
+		plane = (GLCD_Gray_Frame == 2) ? 0 : 1;
+		if (plane != GLCD_Gray_Shown) {
+			SREG = sreg;
+			GLCD_Gray_Flush(plane);
+			cli();
+		}
+	}
+	GLCD_Gray_Locked--;
+	SREG = sreg;
+}
+
+void GLCD_Gray_Bench(GLCD_GrayBenchType* result)
+{
+	uint32_t ticks = 0, fixedUs, cpuUs;
+	uint8_t p, x, plane;
+
+	TIMSK &= (uint8_t)~(1u << OCIE0);
+	for (p = 0; p < GLCD_GRAY_PAGES; p++) {
+		for (x = 0; x < 128; x++) {
+			GLCD_Gray_Plane[0][p][x] = 0x55;
+			GLCD_Gray_Plane[1][p][x] = 0xAA;
+		}
+		GLCD_Gray_DirtyMin[p] = 0xFF;
+		GLCD_Gray_DirtyMax[p] = 0x00;
+	}
+	GLCD_Gray_Commit();
+
+	/* Timer0 free running at F_CPU / 64, one page flush is well below 256 ticks */
+	TCCR0 = 3u;
+	for (plane = 0; plane < 2; plane++) {
+		for (p = 0; p < GLCD_GRAY_PAGES; p++) {
+			TCNT0 = 0;
+			GLCD_WriteRow(GLCD_GRAY_FIRST_PAGE + p, 0, &GLCD_Gray_Plane[plane][p][0], 128);
+			ticks += TCNT0;
+		}
+	}
+	result->FlushUs = (uint16_t)(ticks * (64000000UL / F_CPU) / 2u);
+
+	/* The status read and write strobes of every byte and of the 4 commands of a page do not
+	 * scale with the clock. Extra polls of a busy controller are scaled with the CPU time,
+	 * so the faster clock figures are a lower bound. */
+	fixedUs = (uint32_t)GLCD_GRAY_PAGES * (uint16_t)(132.0 * GLCD_BURST_BYTE_US);
+	cpuUs = (result->FlushUs > fixedUs) ? result->FlushUs - fixedUs : 0u;
+	result->FlushUs8 = (uint16_t)(fixedUs + cpuUs * (F_CPU / 1000000UL) / 8u);
+	result->FlushUs16 = (uint16_t)(fixedUs + cpuUs * (F_CPU / 1000000UL) / 16u);
+
+	/* A switch in 2 of 3 frames, at most half of the frame time on the bus */
+	result->FrameHz8 = (uint16_t)(750000UL / result->FlushUs8);
+	result->FrameHz16 = (uint16_t)(750000UL / result->FlushUs16);
+
+	GLCD_Gray_Init();
+}
+
+/* Interrupts stay enabled during a flush so the PWM edge ISRs are not held back; the
+ * compare interrupt itself is masked, a match during a long flush is dropped instead of
+ * starting a second flush inside the first */
+ISR(TIMER0_COMP_vect)
+{
+	uint8_t plane;
+
+	if (++GLCD_Gray_Frame >= GLCD_GRAY_FRAMES) {
+		GLCD_Gray_Frame = 0;
+	}
+	plane = (GLCD_Gray_Frame == 2) ? 0 : 1;
+	if (plane == GLCD_Gray_Shown) {
+		return;
+	}
+	if (GLCD_Gray_Locked) {
+		GLCD_Gray_Pending = 1;
+		return;
+	}
+	TIMSK &= (uint8_t)~(1u << OCIE0);
+	sei();
+	GLCD_Gray_Flush(plane);
+	cli();
+	TIMSK |= (1u << OCIE0);
+}
+
+#endif /* GLCD_GRAY_USED */
@@ -0,0 +1,65 @@
+/*
+ * GLCD_Gray.h
+ *
+ * Created: 19-Oct-26
+ *  Author: diaag
+ *
+ * Four gray levels on a band of pages by frame-rate control. Every pixel has
+ * a bit in plane 1 and in plane 0; the Timer0 compare ISR shows plane 1 for
+ * two frames and plane 0 for one, so level 2 * b1 + b0 is on for that many
+ * thirds of the time. Only the columns where the planes differ change at a
+ * plane switch, those spans are all the ISR sends.
+ *
+ * The band is in landscape pages. Draw into GLCD_Gray_Plane directly (for
+ * example with GLCD_Gfx_UseBand on each plane) and call GLCD_Gray_Commit, or
+ * use GLCD_Gray_FillRect which marks its own columns. Other GLCD drawing
+ * from the main loop must sit between GLCD_Gray_Lock and GLCD_Gray_Unlock so
+ * the ISR does not move the address in the middle of it.
+ */ 
+
+
+#ifndef GLCD_GRAY_H_
+#define GLCD_GRAY_H_
+
+#include <stdint.h>
+#include "GLCD_Gray_cfg.h"
+
+/* Planes, index 1 is the high bit of the level */
+extern uint8_t GLCD_Gray_Plane[2][GLCD_GRAY_PAGES][128];
+
+/* Clears the planes and starts the plane timer, it runs once interrupts are enabled */
+extern void GLCD_Gray_Init(void);
+
+/* Stops the plane timer, the band keeps whatever plane was shown last */
+extern void GLCD_Gray_Stop(void);
+
+/* Rectangle in level 0..3, coordinates inclusive and in screen pixels */
+extern void GLCD_Gray_FillRect(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, uint8_t level);
+
+/* Marks columns x0..x1 of a screen page as redrawn */
+extern void GLCD_Gray_MarkDirty(uint8_t page, uint8_t x0, uint8_t x1);
+
+/* Marks the whole band as redrawn, after drawing into the planes directly */
+extern void GLCD_Gray_Invalidate(void);
+
+/* Publishes the drawing to the ISR: redrawn columns go out at the next switch, differing ones at every switch */
+extern void GLCD_Gray_Commit(void);
+
+/* Holds the plane switches off the bus while the main loop uses it, nestable */
+extern void GLCD_Gray_Lock(void);
+extern void GLCD_Gray_Unlock(void);
+
+/* Flush cost of a switch with the whole band differing */
+typedef struct
+{
+	uint16_t FlushUs;		/* Measured at F_CPU */
+	uint16_t FlushUs8;		/* Estimated for 8 MHz */
+	uint16_t FlushUs16;		/* Estimated for 16 MHz */
+	uint16_t FrameHz8;		/* Highest frame rate at 8 MHz leaving half of the CPU */
+	uint16_t FrameHz16;		/* The same at 16 MHz */
+} GLCD_GrayBenchType;
+
+/* Times full-band flushes with the ISR stopped, the planes are overwritten and the timer restarted */
+extern void GLCD_Gray_Bench(GLCD_GrayBenchType* result);
+
+#endif /* GLCD_GRAY_H_ */
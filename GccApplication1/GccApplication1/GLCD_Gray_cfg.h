@@ -0,0 +1,27 @@
+/*
+ * GLCD_Gray_cfg.h
+ *
+ * Created: 19-Oct-26
+ *  Author: diaag
+ */ 
+
+
+#ifndef GLCD_GRAY_CFG_H_
+#define GLCD_GRAY_CFG_H_
+
+/* Gray band built in (1u) or left out (0u), it owns Timer0 and the COMP vector */
+#define GLCD_GRAY_USED			(0u)
+
+/* Pages shown in gray: two planes of 128 bytes per page (2 pages = 512 bytes) */
+#define GLCD_GRAY_FIRST_PAGE	(6u)
+#define GLCD_GRAY_PAGES			(2u)
+
+/* Frame rate of the plane sequence and the Timer0 clock divider (8, 64, 256, 1024) */
+#define GLCD_GRAY_FRAME_HZ		(180u)
+#define GLCD_GRAY_PRESCALER		(256u)
+
+/* Shows the flush benchmark at start-up instead of the application screen */
+#define GLCD_GRAY_BENCH			(0u)
+
+
+#endif /* GLCD_GRAY_CFG_H_ */
@@ -0,0 +1,139 @@
+/*
+ * GLCD_Image.c
+ *
+ * Created: 19-Oct-26
+ *  Author: diaag
+ */ 
+
+#include <stdint.h>
+#include <avr/pgmspace.h>
+
+#include "GLCD.h"
+#include "GLCD_Image.h"
+
+#define GLCD_IMAGE_MASK		(GLCD_IMAGE_WINDOW - 1u)
+
+typedef struct {
+	uint8_t Window[GLCD_IMAGE_WINDOW];	/* Last output bytes, ring */
+	uint8_t Head;			/* Next write position in Window */
+	uint8_t Pending;		/* Bytes at the end of Window not sent yet */
+	uint8_t X;				/* Screen column of the image */
+	uint8_t Width;
+	uint8_t Page;			/* Screen page being decoded */
+	uint8_t EndPage;		/* Screen page after the image */
+	uint8_t Col;			/* Image column being decoded */
+} GLCD_Image_DecoderType;
+
+/* Sends n bytes ending at Window[Head] to image columns Col - n.. of the current page */
+static void GLCD_Image_Send(GLCD_Image_DecoderType* dec, uint8_t from, uint8_t col, uint8_t n)
+{
+	uint8_t first;
+
+	if (n == 0 || dec->Page >= GLCD_PAGES || dec->X + col >= GLCD_WIDTH) {
+		return;
+	}
+	first = GLCD_IMAGE_WINDOW - from;
+	if (first >= n) {
+		GLCD_WriteRow(dec->Page, dec->X + col, &dec->Window[from], n);
+	} else {
+		/* The burst wraps around the ring */
+		GLCD_WriteRow(dec->Page, dec->X + col, &dec->Window[from], first);
+		if ((uint8_t)(dec->X + col + first) < GLCD_WIDTH) {
+			GLCD_WriteRow(dec->Page, dec->X + col + first, &dec->Window[0], n - first);
+		}
+	}
+}
+
+static void GLCD_Image_Flush(GLCD_Image_DecoderType* dec)
+{
+	uint8_t n = dec->Pending;
+
+	GLCD_Image_Send(dec, (uint8_t)(dec->Head - n) & GLCD_IMAGE_MASK, dec->Col - n, n);
+	dec->Pending = 0;
+}
+
+/* Ends the page when its last column was decoded */
+static void GLCD_Image_Advance(GLCD_Image_DecoderType* dec)
+{
+	if (dec->Col == dec->Width) {
+		GLCD_Image_Flush(dec);
+		dec->Page++;
+		dec->Col = 0;
+	}
+}
+
+static void GLCD_Image_Put(GLCD_Image_DecoderType* dec, uint8_t value)
+{
+	dec->Window[dec->Head] = value;
+	dec->Head = (dec->Head + 1) & GLCD_IMAGE_MASK;
+	dec->Pending++;
+	dec->Col++;
+	GLCD_Image_Advance(dec);
+}
+
+static void GLCD_Image_Fill(GLCD_Image_DecoderType* dec, uint8_t value, uint8_t n)
+{
+	uint8_t seg, i;
+
+	if (n < GLCD_IMAGE_MIN_FILL) {
+		while (n-- && dec->Page < dec->EndPage) {
+			GLCD_Image_Put(dec, value);
+		}
+		return;
+	}
+	GLCD_Image_Flush(dec);
+	while (n && dec->Page < dec->EndPage) {
+		seg = dec->Width - dec->Col;
+		if (seg > n) {
+			seg = n;
+		}
+		if (dec->Page < GLCD_PAGES && dec->X + dec->Col < GLCD_WIDTH) {
+			GLCD_FillRun(dec->Page, dec->X + dec->Col, value, seg);
+		}
+		/* The run stays in the window for later copies */
+		for (i = 0; i < seg; i++) {
+			dec->Window[dec->Head] = value;
+			dec->Head = (dec->Head + 1) & GLCD_IMAGE_MASK;
+		}
+		dec->Col += seg;
+		n -= seg;
+		GLCD_Image_Advance(dec);
+	}
+}
+
+void GLCD_DrawImage(uint8_t x, uint8_t page, const uint8_t* img)
+{
+	GLCD_Image_DecoderType dec;
+	uint8_t token, n, distance, value;
+
+	dec.Width = pgm_read_byte(img++);
+	dec.EndPage = page + pgm_read_byte(img++);
+	dec.X = x;
+	dec.Page = page;
+	dec.Col = 0;
+	dec.Head = 0;
+	dec.Pending = 0;
+	if (dec.Width == 0 || x >= GLCD_WIDTH) {
+		return;
+	}
+
+	while (dec.Page < dec.EndPage && dec.Page < GLCD_PAGES)
+	{
+		token = pgm_read_byte(img++);
+		if (token < 0x80) {
+			/* Literal bytes */
+			for (n = token + 1; n && dec.Page < dec.EndPage; n--) {
+				GLCD_Image_Put(&dec, pgm_read_byte(img++));
+			}
+		} else if (token < 0xC0) {
+			value = pgm_read_byte(img++);
+			GLCD_Image_Fill(&dec, value, (token & 0x3F) + 3);
+		} else {
+			/* Copy from the window, byte by byte so overlapping copies repeat a pattern */
+			distance = pgm_read_byte(img++) + 1;
+			for (n = (token & 0x3F) + 3; n && dec.Page < dec.EndPage; n--) {
+				GLCD_Image_Put(&dec, dec.Window[(uint8_t)(dec.Head - distance) & GLCD_IMAGE_MASK]);
+			}
+		}
+	}
+}
@@ -0,0 +1,36 @@
+/*
+ * GLCD_Image.h
+ *
+ * Created: 19-Oct-26
+ *  Author: diaag
+ *
+ * Compressed images in program memory, decoded straight to the display.
+ *
+ * An image starts with its width in columns (up to 128) and its height in pages,
+ * followed by a token stream of the page-major column bytes (page 0 columns
+ * 0..w-1, then page 1, ...). Tokens may continue across pages:
+ *  - 0x00..0x7F  n + 1 literal bytes follow
+ *  - 0x80..0xBF  run: the next byte repeated (n & 0x3F) + 3 times
+ *  - 0xC0..0xFF  copy: (n & 0x3F) + 3 bytes from d + 1 bytes back in the
+ *                output, d is the next byte (0..127); copies may overlap
+ *
+ * The decoder keeps the last 128 output bytes for the copies; literal and
+ * copied bytes are sent as bursts from that window and runs of
+ * GLCD_IMAGE_MIN_FILL bytes or more as GLCD_FillRun, so no full image
+ * buffer is needed. Tools/ImgEnc converts a PBM file into such an array.
+ */ 
+
+
+#ifndef GLCD_IMAGE_H_
+#define GLCD_IMAGE_H_
+
+#include <stdint.h>
+
+#define GLCD_IMAGE_WINDOW		(128u)	/* Copy distance limit, power of 2 */
+#define GLCD_IMAGE_MIN_FILL		(4u)	/* Shorter runs go with the surrounding burst */
+
+/* Draws the image img (program memory) with its top left corner at column x of page, clipped to the screen */
+extern void GLCD_DrawImage(uint8_t x, uint8_t page, const uint8_t* img);
+
+
+#endif /* GLCD_IMAGE_H_ */
@@ -0,0 +1,94 @@
+/*
+ * GLCD_Plot.c
+ *
+ * Created: 19-Oct-26
+ *  Author: diaag
+ */ 
+
+#include <stdint.h>
+
+#include "GLCD.h"
+#include "GLCD_Plot.h"
+
+/* Mask of the pixel rows first..last (inclusive) that fall inside page p */
+static uint8_t GLCD_Plot_RowMask(uint8_t p, uint8_t first, uint8_t last)
+{
+	uint8_t top = p * 8, bottom = top + 7;
+	uint8_t mask = 0xFF;
+
+	if (last < top || first > bottom) {
+		return 0x00;
+	}
+	if (first > top) {
+		mask &= (uint8_t)(0xFF << (first - top));
+	}
+	if (last < bottom) {
+		mask &= (uint8_t)(0xFF >> (bottom - last));
+	}
+	return mask;
+}
+
+void GLCD_Plot_Init(GLCD_PlotType* plot, uint8_t firstPage, uint8_t pages, uint8_t baseline, uint8_t height)
+{
+	uint8_t p, high;
+
+	if (firstPage > GLCD_PAGES - 1) {
+		firstPage = GLCD_PAGES - 1;
+	}
+	if (pages == 0 || pages > GLCD_PAGES - firstPage) {
+		pages = GLCD_PAGES - firstPage;
+	}
+	if (pages > GLCD_PLOT_MAX_PAGES) {
+		pages = GLCD_PLOT_MAX_PAGES;
+	}
+	if (baseline > pages * 8 - 1) {
+		baseline = pages * 8 - 1;
+	}
+	high = (height > baseline) ? 0 : baseline - height;
+
+	plot->FirstPage = firstPage;
+	plot->Pages = pages;
+	for (p = 0; p < pages; p++)
+	{
+		plot->Pattern[p][GLCD_PLOT_LOW]  = GLCD_Plot_RowMask(p, baseline, baseline);
+		plot->Pattern[p][GLCD_PLOT_HIGH] = GLCD_Plot_RowMask(p, high, high);
+		plot->Pattern[p][GLCD_PLOT_EDGE] = GLCD_Plot_RowMask(p, high, baseline);
+	}
+}
+
+void GLCD_Plot_RenderSquare(const GLCD_PlotType* plot, uint8_t p, uint8_t* row, uint8_t width, uint8_t period, uint8_t highCols)
+{
+	uint8_t i, phase = 0;
+	uint8_t edges = (highCols != 0) && (highCols < period);
+	const uint8_t* pattern = plot->Pattern[p];
+
+	if (period == 0) {
+		period = 1;
+	}
+	for (i = 0; i < width; i++)
+	{
+		if (edges && (phase == 0 || phase == highCols)) {
+			row[i] = pattern[GLCD_PLOT_EDGE];
+		} else if (phase < highCols) {
+			row[i] = pattern[GLCD_PLOT_HIGH];
+		} else {
+			row[i] = pattern[GLCD_PLOT_LOW];
+		}
+
+		if (++phase >= period) {
+			phase = 0;
+		}
+	}
+}
+
+void GLCD_Plot_DrawSquare(const GLCD_PlotType* plot, uint8_t period, uint8_t highCols)
+{
+	uint8_t row[128];
+	uint8_t p, width = GLCD_WIDTH;
+
+	for (p = 0; p < plot->Pages; p++)
+	{
+		GLCD_Plot_RenderSquare(plot, p, row, width, period, highCols);
+		GLCD_WriteRow(plot->FirstPage + p, 0, row, width);
+	}
+}
@@ -0,0 +1,46 @@
+/*
+ * GLCD_Plot.h
+ *
+ * Created: 19-Oct-26
+ *  Author: diaag
+ *
+ * Multi-page waveform plot widget. The trace is described by a high row and a
+ * baseline (low) row inside an area of N pages; the column bytes for high, low
+ * and edge columns are precomputed per page so drawing costs one pattern
+ * lookup per column and page.
+ */ 
+
+
+#ifndef GLCD_PLOT_H_
+#define GLCD_PLOT_H_
+
+#include <stdint.h>
+
+#define GLCD_PLOT_MAX_PAGES	(8u)
+
+/* Column classes, used as index into the per-page pattern table */
+#define GLCD_PLOT_LOW		(0u)
+#define GLCD_PLOT_HIGH		(1u)
+#define GLCD_PLOT_EDGE		(2u)
+
+typedef struct {
+	uint8_t FirstPage;	/* Top page of the plot area */
+	uint8_t Pages;		/* Number of pages spanned by the plot area */
+	uint8_t Pattern[GLCD_PLOT_MAX_PAGES][3];	/* Column byte per page and class */
+} GLCD_PlotType;
+
+/*
+ * firstPage/pages : plot area, pages are clipped to the bottom of the screen
+ * baseline        : pixel row of the low level, relative to the top of the area
+ * height          : amplitude in pixels, the high level is drawn at baseline-height
+ */
+extern void GLCD_Plot_Init(GLCD_PlotType* plot, uint8_t firstPage, uint8_t pages, uint8_t baseline, uint8_t height);
+
+/* Column bytes of page p of the plot (0 = top page of the area) for width columns of the wave */
+extern void GLCD_Plot_RenderSquare(const GLCD_PlotType* plot, uint8_t p, uint8_t* row, uint8_t width, uint8_t period, uint8_t highCols);
+
+/* Draws a square wave across the screen width: period and high time in columns */
+extern void GLCD_Plot_DrawSquare(const GLCD_PlotType* plot, uint8_t period, uint8_t highCols);
+
+
+#endif /* GLCD_PLOT_H_ */
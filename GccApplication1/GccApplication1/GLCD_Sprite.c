@@ -0,0 +1,184 @@
+/*
+ * GLCD_Sprite.c
+ *
+ * Created: 19-Oct-26
+ *  Author: diaag
+ */ 
+
+#include <stdint.h>
+#include <avr/pgmspace.h>
+
+#include "GLCD.h"
+#include "GLCD_Sprite.h"
+
+/* One placement of a sprite */
+typedef struct {
+	const GLCD_SpriteType* Sprite;
+	int16_t X;
+	int16_t Y;
+} GLCD_SpritePlaceType;
+
+/* Sprite column byte of source page sp, rows below Height cleared */
+static uint8_t GLCD_Sprite_Source(const GLCD_SpriteType* s, int16_t sp, uint8_t c)
+{
+	uint8_t pages = (uint8_t)((s->Height + 7) / 8);
+	uint8_t b;
+
+	if (sp < 0 || sp >= pages) {
+		return 0x00;
+	}
+	b = pgm_read_byte(&s->Image[(uint16_t)sp * s->Width + c]);
+	if (sp == pages - 1 && (s->Height & 7)) {
+		b &= (uint8_t)((1u << (s->Height & 7)) - 1u);
+	}
+	return b;
+}
+
+/* Byte the placement puts at screen column col of page, 0 outside it */
+static uint8_t GLCD_Sprite_Byte(const GLCD_SpritePlaceType* p, uint8_t page, int16_t col)
+{
+	int16_t sp = (int16_t)page - (p->Y >> 3);	/* Arithmetic shift, floor for y < 0 */
+	uint8_t shift = (uint8_t)(p->Y & 7);
+	uint8_t c;
+
+	if (col < p->X || col >= p->X + p->Sprite->Width) {
+		return 0x00;
+	}
+	c = (uint8_t)(col - p->X);
+	if (shift == 0) {
+		return GLCD_Sprite_Source(p->Sprite, sp, c);
+	}
+	return (uint8_t)((GLCD_Sprite_Source(p->Sprite, sp, c) << shift)
+	               | (GLCD_Sprite_Source(p->Sprite, sp - 1, c) >> (8 - shift)));
+}
+
+/* Pages first..last the placement covers */
+static uint8_t GLCD_Sprite_OnPage(const GLCD_SpritePlaceType* p, uint8_t page)
+{
+	return (int16_t)page >= (p->Y >> 3) && (int16_t)page <= ((p->Y + p->Sprite->Height - 1) >> 3);
+}
+
+/* XOR of placements a and b (b may be 0) at screen column col of page */
+static uint8_t GLCD_Sprite_Bits(const GLCD_SpritePlaceType* a, const GLCD_SpritePlaceType* b, uint8_t page, int16_t col)
+{
+	uint8_t bits = GLCD_Sprite_Byte(a, page, col);
+
+	if (b) {
+		bits ^= GLCD_Sprite_Byte(b, page, col);
+	}
+	return bits;
+}
+
+/* XORs placements a and b (b may be 0) into columns x0..x1 of page, one read and one write
+ * per row buffer; x0..x1 is one placement or the union of two that overlap or touch */
+static void GLCD_Sprite_Pass(const GLCD_SpritePlaceType* a, const GLCD_SpritePlaceType* b, uint8_t page, int16_t x0, int16_t x1)
+{
+	uint8_t row[2 * GLCD_SPRITE_MAX_WIDTH];
+	uint8_t n, i;
+
+	if (x0 < 0) x0 = 0;
+	if (x1 > (int16_t)GLCD_WIDTH - 1) x1 = (int16_t)GLCD_WIDTH - 1;
+
+	/* Columns where old and new agree need no bus traffic */
+	while (x0 <= x1 && GLCD_Sprite_Bits(a, b, page, x0) == 0) {
+		x0++;
+	}
+	if (x0 > x1) {
+		return;
+	}
+	while (GLCD_Sprite_Bits(a, b, page, x1) == 0) {
+		x1--;
+	}
+
+	while (x0 <= x1)
+	{
+		n = (x1 - x0 < (int16_t)sizeof(row)) ? (uint8_t)(x1 - x0 + 1) : (uint8_t)sizeof(row);
+		GLCD_ReadRow(page, (uint8_t)x0, row, n);
+		for (i = 0; i < n; i++) {
+			row[i] ^= GLCD_Sprite_Bits(a, b, page, x0 + i);
+		}
+		GLCD_WriteRow(page, (uint8_t)x0, row, n);
+		x0 += n;
+	}
+}
+
+/* XOR of old (or 0) and new (or 0), pages in turn */
+static void GLCD_Sprite_Xor(const GLCD_SpritePlaceType* from, const GLCD_SpritePlaceType* to)
+{
+	uint8_t page, onFrom, onTo, w;
+
+	for (page = 0; page < GLCD_PAGES; page++)
+	{
+		onFrom = from && GLCD_Sprite_OnPage(from, page);
+		onTo = to && GLCD_Sprite_OnPage(to, page);
+		if (onFrom && onTo)
+		{
+			w = from->Sprite->Width;
+			if (to->X <= from->X + w && from->X <= to->X + w) {
+				/* Overlapping or adjacent: one pass over the union */
+				GLCD_Sprite_Pass(from, to, page, (from->X < to->X) ? from->X : to->X,
+				                 ((from->X > to->X) ? from->X : to->X) + w - 1);
+				continue;
+			}
+		}
+		if (onFrom) {
+			GLCD_Sprite_Pass(from, 0, page, from->X, from->X + from->Sprite->Width - 1);
+		}
+		if (onTo) {
+			GLCD_Sprite_Pass(to, 0, page, to->X, to->X + to->Sprite->Width - 1);
+		}
+	}
+}
+
+void GLCD_Sprite_Init(GLCD_SpriteType* sprite, const uint8_t* image, uint8_t width, uint8_t height)
+{
+	sprite->Image = image;
+	sprite->Width = width;
+	sprite->Height = height;
+	sprite->X = 0;
+	sprite->Y = 0;
+	sprite->Visible = 0;
+}
+
+void GLCD_Sprite_Show(GLCD_SpriteType* sprite, int16_t x, int16_t y)
+{
+	GLCD_SpritePlaceType from, to;
+
+	if (sprite->Visible && sprite->X == x && sprite->Y == y) {
+		return;
+	}
+	from.Sprite = sprite;
+	from.X = sprite->X;
+	from.Y = sprite->Y;
+	to.Sprite = sprite;
+	to.X = x;
+	to.Y = y;
+	GLCD_Sprite_Xor(sprite->Visible ? &from : 0, &to);
+	sprite->X = x;
+	sprite->Y = y;
+	sprite->Visible = 1;
+}
+
+void GLCD_Sprite_Hide(GLCD_SpriteType* sprite)
+{
+	GLCD_SpritePlaceType from;
+
+	if (!sprite->Visible) {
+		return;
+	}
+	from.Sprite = sprite;
+	from.X = sprite->X;
+	from.Y = sprite->Y;
+	GLCD_Sprite_Xor(&from, 0);
+	sprite->Visible = 0;
+}
+
+void GLCD_Sprite_Move(GLCD_SpriteType* sprite, int16_t x, int16_t y)
+{
+	GLCD_Sprite_Show(sprite, x, y);
+}
+
+void GLCD_Sprite_Invalidate(GLCD_SpriteType* sprite)
+{
+	sprite->Visible = 0;
+}
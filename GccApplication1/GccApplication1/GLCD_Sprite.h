@@ -0,0 +1,53 @@
+/*
+ * GLCD_Sprite.h
+ *
+ * Created: 19-Oct-26
+ *  Author: diaag
+ *
+ * XOR sprites for cursors and markers. A sprite is XORed onto whatever the
+ * display shows, read back through GLCD_ReadRow, so XORing it again at the
+ * same place restores the background and nothing underneath is redrawn.
+ * A move XORs the old and the new placement in one read and one write per
+ * page when they overlap, and only over the columns whose bytes change.
+ * GLCD_ReadRow/GLCD_WriteRow take care of the two chip halves.
+ *
+ * Drawing under a visible sprite breaks the XOR: hide it first, or call
+ * GLCD_Sprite_Invalidate after the area was redrawn and show it again.
+ */ 
+
+
+#ifndef GLCD_SPRITE_H_
+#define GLCD_SPRITE_H_
+
+#include <stdint.h>
+
+/* Widest sprite moved with one read and one write per page (a move covers at most twice
+ * this many columns), wider sprites take one more of each per extra 2 * width columns */
+#define GLCD_SPRITE_MAX_WIDTH	(32u)
+
+typedef struct {
+	const uint8_t* Image;	/* Program memory, page-major: (Height + 7) / 8 pages of Width column bytes */
+	uint8_t Width;
+	uint8_t Height;
+	int16_t X;				/* Top left pixel while visible, may be off screen */
+	int16_t Y;
+	uint8_t Visible;
+} GLCD_SpriteType;
+
+/* Binds the image, the sprite starts hidden */
+extern void GLCD_Sprite_Init(GLCD_SpriteType* sprite, const uint8_t* image, uint8_t width, uint8_t height);
+
+/* XORs the sprite in with its top left pixel at x, y, moving it if already visible */
+extern void GLCD_Sprite_Show(GLCD_SpriteType* sprite, int16_t x, int16_t y);
+
+/* XORs the sprite out, the background comes back */
+extern void GLCD_Sprite_Hide(GLCD_SpriteType* sprite);
+
+/* Moves a visible sprite, same as GLCD_Sprite_Show */
+extern void GLCD_Sprite_Move(GLCD_SpriteType* sprite, int16_t x, int16_t y);
+
+/* The area under the sprite was redrawn without it, the sprite is hidden now */
+extern void GLCD_Sprite_Invalidate(GLCD_SpriteType* sprite);
+
+
+#endif /* GLCD_SPRITE_H_ */
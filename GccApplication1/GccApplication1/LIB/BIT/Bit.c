@@ -0,0 +1,87 @@
+/*
+ * Bit.c
+ *
+ * Created: 19 October 2026
+ * Author: Diaa Ahmed
+ * Description: Implementation file for the bit-matrix library.
+ * 
+ * This file contains the shared page mask tables and the target and the host versions of
+ * the 8x8 transpose.
+ */
+
+#include <stdint.h>
+#include "Bit.h"
+
+const uint8_t Bit_FromRowTable[8] PROGMEM = { 0xFFu, 0xFEu, 0xFCu, 0xF8u, 0xF0u, 0xE0u, 0xC0u, 0x80u };
+const uint8_t Bit_ToRowTable[8] PROGMEM   = { 0x01u, 0x03u, 0x07u, 0x0Fu, 0x1Fu, 0x3Fu, 0x7Fu, 0xFFu };
+const uint8_t Bit_RowTable[8] PROGMEM     = { 0x01u, 0x02u, 0x04u, 0x08u, 0x10u, 0x20u, 0x40u, 0x80u };
+
+#if defined(__AVR__)
+
+/* Moves bit 0 of Row into bit 7 of Out[c] while shifting the older rows down */
+#define BIT_TRANSPOSE_STEP(c)   Out[c] = (uint8_t)((Out[c] >> 1) | (uint8_t)(Row << 7)); Row >>= 1
+
+/**************************************************************
+ * Description: Transposes an 8x8 bit matrix.
+ * Parameters:
+ *   - In: 8 bytes, element (r, c) is bit c of In[r].
+ *   - Out: 8 bytes, receives element (r, c) as bit r of Out[c]; must not overlap In.
+ * Outputs:
+ *   - None
+ * Note:
+ *   - After the 8 rows, row r has been shifted down 7 - r times from bit 7, i.e. sits in bit r.
+ *     The column steps are unrolled so every shift is a single LSR / ROR.
+ **************************************************************/
+void Bit_Transpose8x8(const uint8_t* In, uint8_t* Out)
+{
+    uint8_t r, Row;
+
+    for (r = 0u; r < 8u; r++)
+    {
+        Row = In[r];
+        BIT_TRANSPOSE_STEP(0);
+        BIT_TRANSPOSE_STEP(1);
+        BIT_TRANSPOSE_STEP(2);
+        BIT_TRANSPOSE_STEP(3);
+        BIT_TRANSPOSE_STEP(4);
+        BIT_TRANSPOSE_STEP(5);
+        BIT_TRANSPOSE_STEP(6);
+        BIT_TRANSPOSE_STEP(7);
+    }
+}
+
+#else
+
+/**************************************************************
+ * Description: Transposes an 8x8 bit matrix.
+ * Parameters:
+ *   - In: 8 bytes, element (r, c) is bit c of In[r].
+ *   - Out: 8 bytes, receives element (r, c) as bit r of Out[c]; must not overlap In.
+ * Outputs:
+ *   - None
+ * Note:
+ *   - The matrix is packed into 64 bits (byte r = row r) and transposed by swapping 1x1, 2x2
+ *     and 4x4 blocks across the diagonal.
+ **************************************************************/
+void Bit_Transpose8x8(const uint8_t* In, uint8_t* Out)
+{
+    uint64_t x = 0u, t;
+    uint8_t i;
+
+    for (i = 0u; i < 8u; i++)
+    {
+        x |= (uint64_t)In[i] << (8u * i);
+    }
+    t = (x ^ (x >> 7)) & 0x00AA00AA00AA00AAull;
+    x ^= t ^ (t << 7);
+    t = (x ^ (x >> 14)) & 0x0000CCCC0000CCCCull;
+    x ^= t ^ (t << 14);
+    t = (x ^ (x >> 28)) & 0x00000000F0F0F0F0ull;
+    x ^= t ^ (t << 28);
+    for (i = 0u; i < 8u; i++)
+    {
+        Out[i] = (uint8_t)(x >> (8u * i));
+    }
+}
+
+#endif
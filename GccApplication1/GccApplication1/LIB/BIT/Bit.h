@@ -0,0 +1,88 @@
+/*
+ * Bit.h
+ *
+ * Created: 19 October 2026
+ * Author: Diaa Ahmed
+ * Description: Header file for the bit-matrix library.
+ * 
+ * This file contains the 8x8 bit transpose that converts between row-major bitmaps (one byte
+ * per pixel row, as image tools and PBM files produce them) and the page-major column bytes
+ * of the KS0108 (one byte per pixel column of a page). The same source builds for the target
+ * and for the host tools: the AVR version shifts through the carry, which costs constant
+ * single-bit shifts only, the host version uses three 64 bit swap steps.
+ */ 
+
+#ifndef BIT_H_
+#define BIT_H_
+
+#include <stdint.h>
+#if defined(__AVR__)
+#include <avr/pgmspace.h>
+#define BIT_TABLE_READ(Entry)   pgm_read_byte(&(Entry))
+#else
+#ifndef PROGMEM
+#define PROGMEM
+#endif
+#define BIT_TABLE_READ(Entry)   (Entry)
+#endif
+
+/* Page masks in flash: rows n..7, rows 0..n and row n alone (1 << n) */
+extern const uint8_t Bit_FromRowTable[8] PROGMEM;
+extern const uint8_t Bit_ToRowTable[8] PROGMEM;
+extern const uint8_t Bit_RowTable[8] PROGMEM;
+
+/**************************************************************
+ * Description: Transposes an 8x8 bit matrix.
+ * Parameters:
+ *   - In: 8 bytes, element (r, c) is bit c of In[r].
+ *   - Out: 8 bytes, receives element (r, c) as bit r of Out[c]; must not overlap In.
+ * Outputs:
+ *   - None
+ * Note:
+ *   - A row-major block with the leftmost pixel in bit 0 becomes page-major columns directly:
+ *     Out[x] is column x with the top row in bit 0. PBM rows have the leftmost pixel in bit 7,
+ *     so their column x is Out[7 - x].
+ **************************************************************/
+extern void Bit_Transpose8x8(const uint8_t* In, uint8_t* Out);
+
+/**************************************************************
+ * Description: Reverses the bit order of a byte.
+ * Parameters:
+ *   - Value: Byte to mirror.
+ * Outputs:
+ *   - uint8_t: Bit 0 of Value in bit 7 and so on.
+ **************************************************************/
+static inline uint8_t Bit_Reverse8(uint8_t Value)
+{
+    Value = (uint8_t)(((Value & 0xF0u) >> 4) | ((Value & 0x0Fu) << 4));
+    Value = (uint8_t)(((Value & 0xCCu) >> 2) | ((Value & 0x33u) << 2));
+    return (uint8_t)(((Value & 0xAAu) >> 1) | ((Value & 0x55u) << 1));
+}
+
+
+/**************************************************************
+ * Description: Page byte masks of a pixel row, read from the shared flash tables.
+ * Parameters:
+ *   - Row: Pixel row within the page, only the low 3 bits are used.
+ * Outputs:
+ *   - uint8_t: Bit_FromRow rows Row..7, Bit_ToRow rows 0..Row, Bit_Row 1 << Row.
+ * Note:
+ *   - The AVR shifts by a variable count one bit per loop pass, a table read takes 3 cycles.
+ **************************************************************/
+static inline uint8_t Bit_FromRow(uint8_t Row)
+{
+    return BIT_TABLE_READ(Bit_FromRowTable[Row & 7u]);
+}
+
+static inline uint8_t Bit_ToRow(uint8_t Row)
+{
+    return BIT_TABLE_READ(Bit_ToRowTable[Row & 7u]);
+}
+
+static inline uint8_t Bit_Row(uint8_t Row)
+{
+    return BIT_TABLE_READ(Bit_RowTable[Row & 7u]);
+}
+
+
+#endif /* BIT_H_ */
@@ -0,0 +1,258 @@
+/*
+ * Fmt.c
+ *
+ * Created: 19 October 2026
+ * Author: Diaa Ahmed
+ * Description: Implementation file for the numeric formatting library.
+ * 
+ * This file contains the digit generation by repeated subtraction and the field writers
+ * built on it. Fmt_Digits produces the significant digits once, the writers only place
+ * them, the decimal point and the unit into the field.
+ */
+
+#include <stdint-gcc.h>
+#include "../FXP/Fxp.h"
+#include "Fmt.h"
+
+/* Maximum number of decimal digits of a 32 bit value */
+#define FMT_MAX_DIGITS      (10u)
+
+static const uint32_t Fmt_Pow10[FMT_MAX_DIGITS] = {
+    1000000000u, 100000000u, 10000000u, 1000000u, 100000u,
+    10000u, 1000u, 100u, 10u, 1u
+};
+
+/* Writes the significant digits of Value (at least one) to Digits, returns their count */
+static uint8_t Fmt_Digits(uint32_t Value, char* Digits)
+{
+    uint8_t i, Count = 0u;
+    char Digit;
+
+    for (i = 0u; i < FMT_MAX_DIGITS; i++)
+    {
+        Digit = '0';
+        while (Value >= Fmt_Pow10[i])
+        {
+            Value -= Fmt_Pow10[i];
+            Digit++;
+        }
+        if ((Count != 0u) || (Digit != '0') || (i == FMT_MAX_DIGITS - 1u))
+        {
+            Digits[Count++] = Digit;
+        }
+    }
+    return Count;
+}
+
+static void Fmt_Fill(char* Field, uint8_t Width, char Fill)
+{
+    while (Width--)
+    {
+        *Field++ = Fill;
+    }
+}
+
+/**************************************************************
+ * Description: Converts a value into packed BCD with the double-dabble algorithm.
+ * Parameters:
+ *   - Value: 0..65535.
+ * Outputs:
+ *   - uint32_t: Five BCD digits, the least significant digit in bits 3..0.
+ **************************************************************/
+uint32_t Fmt_U16ToBcd(uint16_t Value)
+{
+    uint32_t Bcd = 0u;
+    uint8_t Bit, Nibble;
+
+    for (Bit = 0u; Bit < 16u; Bit++)
+    {
+        /* Add 3 to every BCD digit of 5 or more before shifting */
+        for (Nibble = 0u; Nibble < 20u; Nibble += 4u)
+        {
+            if (((Bcd >> Nibble) & 0x0Fu) >= 5u)
+            {
+                Bcd += (uint32_t)3u << Nibble;
+            }
+        }
+        Bcd = (Bcd << 1) | ((Value & 0x8000u) ? 1u : 0u);
+        Value <<= 1;
+    }
+    return Bcd;
+}
+
+/**************************************************************
+ * Description: Writes an unsigned value into a field.
+ * Parameters:
+ *   - Field: First character of the field.
+ *   - Width: Field width in characters.
+ *   - Value: Value to write.
+ *   - Pad: Character used left of the number (' ' or '0').
+ * Outputs:
+ *   - None
+ **************************************************************/
+void Fmt_U32(char* Field, uint8_t Width, uint32_t Value, char Pad)
+{
+    char Digits[FMT_MAX_DIGITS];
+    uint8_t Count = Fmt_Digits(Value, Digits);
+    uint8_t i;
+
+    if (Count > Width)
+    {
+        Fmt_Fill(Field, Width, '*');
+        return;
+    }
+    Fmt_Fill(Field, Width - Count, Pad);
+    Field += Width - Count;
+    for (i = 0u; i < Count; i++)
+    {
+        Field[i] = Digits[i];
+    }
+}
+
+/**************************************************************
+ * Description: Writes a fixed-point value with a decimal point into a field.
+ * Parameters:
+ *   - Field: First character of the field.
+ *   - Width: Field width in characters, including the point.
+ *   - Value: Value scaled by 10^Decimals (375 with 1 decimal is "37.5").
+ *   - Decimals: Digits right of the point, 0 writes an integer.
+ * Outputs:
+ *   - None
+ **************************************************************/
+void Fmt_Fixed(char* Field, uint8_t Width, uint32_t Value, uint8_t Decimals)
+{
+    char Digits[FMT_MAX_DIGITS];
+    uint8_t Count = Fmt_Digits(Value, Digits);
+    uint8_t Total, Integer, i, Src;
+
+    if (Decimals == 0u)
+    {
+        Fmt_U32(Field, Width, Value, ' ');
+        return;
+    }
+
+    /* At least one integer digit: 5 with 1 decimal is "0.5" */
+    Integer = (Count > Decimals) ? (uint8_t)(Count - Decimals) : 1u;
+    Total = Integer + 1u + Decimals;
+    if (Total > Width)
+    {
+        Fmt_Fill(Field, Width, '*');
+        return;
+    }
+    Fmt_Fill(Field, Width - Total, ' ');
+    Field += Width - Total;
+
+    /* Src runs over the digits with leading zeros implied for short values */
+    Src = (uint8_t)(Integer + Decimals - Count);
+    for (i = 0u; i < Integer + Decimals; i++)
+    {
+        if (i == Integer)
+        {
+            *Field++ = '.';
+        }
+        *Field++ = (i < Src) ? '0' : Digits[i - Src];
+    }
+}
+
+/**************************************************************
+ * Description: Writes a duty cycle as a percentage into a field.
+ * Parameters:
+ *   - Field: First character of the field.
+ *   - Width: Field width in characters ("100.0" needs 5).
+ *   - Duty: 0x0000..0x8000.
+ *   - Decimals: 0 or 1.
+ * Outputs:
+ *   - None
+ * Note:
+ *   - The percentage is rounded with a multiply and a shift.
+ **************************************************************/
+void Fmt_DutyPercent(char* Field, uint8_t Width, uint16_t Duty, uint8_t Decimals)
+{
+    if (Decimals == 0u)
+    {
+        Fmt_U32(Field, Width, Fxp_DutyToPercent(Duty), ' ');
+    }
+    else
+    {
+        /* Tenths of a percent: Duty * 1000 / 0x8000 */
+        Fmt_Fixed(Field, Width, ((uint32_t)Duty * 1000u + 0x4000u) >> 15, 1u);
+    }
+}
+
+/**************************************************************
+ * Description: Writes a frequency with an automatic unit into a field.
+ * Parameters:
+ *   - Field: First character of the field.
+ *   - Width: Field width in characters, the last 3 hold the unit (" HZ", "KHZ", "MHZ").
+ *   - DeciHz: Frequency in 0.1 Hz.
+ * Outputs:
+ *   - None
+ * Note:
+ *   - The number keeps up to 4 significant digits (truncated), e.g. "31.25KHZ", "320.0 HZ".
+ **************************************************************/
+void Fmt_Frequency(char* Field, uint8_t Width, uint32_t DeciHz)
+{
+    char Digits[FMT_MAX_DIGITS];
+    uint8_t Count = Fmt_Digits(DeciHz, Digits);
+    uint8_t Shift, Integer, Decimals, Total, i;
+    char Prefix;
+
+    if (Width < 4u)
+    {
+        Fmt_Fill(Field, Width, '*');
+        return;
+    }
+
+    /* The unit only moves the decimal point: 1 digit for Hz, 4 for kHz, 7 for MHz */
+    if (DeciHz >= 10000000u)
+    {
+        Shift = 7u;
+        Prefix = 'M';
+    }
+    else if (DeciHz >= 10000u)
+    {
+        Shift = 4u;
+        Prefix = 'K';
+    }
+    else
+    {
+        Shift = 1u;
+        Prefix = ' ';
+    }
+
+    Integer = (Count > Shift) ? (uint8_t)(Count - Shift) : 0u;
+    Decimals = (Integer < 4u) ? (4u - Integer) : 0u;
+    if (Decimals > Shift)
+    {
+        Decimals = Shift;
+    }
+
+    Field[Width - 3u] = Prefix;
+    Field[Width - 2u] = 'H';
+    Field[Width - 1u] = 'Z';
+    Width -= 3u;
+
+    if (Integer == 0u)
+    {
+        /* Below 1 Hz: "0.x" */
+        Fmt_Fixed(Field, Width, DeciHz, 1u);
+        return;
+    }
+
+    Total = Integer + ((Decimals != 0u) ? (1u + Decimals) : 0u);
+    if (Total > Width)
+    {
+        Fmt_Fill(Field, Width, '*');
+        return;
+    }
+    Fmt_Fill(Field, Width - Total, ' ');
+    Field += Width - Total;
+    for (i = 0u; i < Integer + Decimals; i++)
+    {
+        if (i == Integer)
+        {
+            *Field++ = '.';
+        }
+        *Field++ = Digits[i];
+    }
+}
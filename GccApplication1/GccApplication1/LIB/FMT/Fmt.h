@@ -0,0 +1,84 @@
+/*
+ * Fmt.h
+ *
+ * Created: 19 October 2026
+ * Author: Diaa Ahmed
+ * Description: Header file for the numeric formatting library.
+ * 
+ * This file contains the declarations of the division-free number formatters used for the
+ * GLCD readouts. Every formatter writes exactly Width characters into a field of a text
+ * buffer (no terminating NUL), right aligned, so a template such as "Duty Cycle = ---.- %"
+ * is updated in place. Digits are produced by repeated subtraction of powers of ten, which
+ * needs at most 9 subtractions per digit instead of a 16 or 32 bit division; a value that
+ * does not fit is shown as '*' characters.
+ */ 
+
+#ifndef FMT_H_
+#define FMT_H_
+
+#include <stdint.h>
+
+/* Function prototypes */
+
+/**************************************************************
+ * Description: Converts a value into packed BCD with the double-dabble algorithm.
+ * Parameters:
+ *   - Value: 0..65535.
+ * Outputs:
+ *   - uint32_t: Five BCD digits, the least significant digit in bits 3..0.
+ **************************************************************/
+extern uint32_t Fmt_U16ToBcd(uint16_t Value);
+
+/**************************************************************
+ * Description: Writes an unsigned value into a field.
+ * Parameters:
+ *   - Field: First character of the field.
+ *   - Width: Field width in characters.
+ *   - Value: Value to write.
+ *   - Pad: Character used left of the number (' ' or '0').
+ * Outputs:
+ *   - None
+ **************************************************************/
+extern void Fmt_U32(char* Field, uint8_t Width, uint32_t Value, char Pad);
+
+/**************************************************************
+ * Description: Writes a fixed-point value with a decimal point into a field.
+ * Parameters:
+ *   - Field: First character of the field.
+ *   - Width: Field width in characters, including the point.
+ *   - Value: Value scaled by 10^Decimals (375 with 1 decimal is "37.5").
+ *   - Decimals: Digits right of the point, 0 writes an integer.
+ * Outputs:
+ *   - None
+ **************************************************************/
+extern void Fmt_Fixed(char* Field, uint8_t Width, uint32_t Value, uint8_t Decimals);
+
+/**************************************************************
+ * Description: Writes a duty cycle as a percentage into a field.
+ * Parameters:
+ *   - Field: First character of the field.
+ *   - Width: Field width in characters ("100.0" needs 5).
+ *   - Duty: 0x0000..0x8000.
+ *   - Decimals: 0 or 1.
+ * Outputs:
+ *   - None
+ * Note:
+ *   - The percentage is rounded with a multiply and a shift.
+ **************************************************************/
+extern void Fmt_DutyPercent(char* Field, uint8_t Width, uint16_t Duty, uint8_t Decimals);
+
+/**************************************************************
+ * Description: Writes a frequency with an automatic unit into a field.
+ * Parameters:
+ *   - Field: First character of the field.
+ *   - Width: Field width in characters, the last 3 hold the unit (" HZ", "KHZ", "MHZ").
+ *   - DeciHz: Frequency in 0.1 Hz.
+ * Outputs:
+ *   - None
+ * Note:
+ *   - The number keeps up to 4 significant digits (truncated), e.g. "31.25KHZ", "320.0 HZ".
+ **************************************************************/
+extern void Fmt_Frequency(char* Field, uint8_t Width, uint32_t DeciHz);
+
+
+#endif /* FMT_H_ */
@@ -0,0 +1,85 @@
+/*
+ * Fxp.c
+ *
+ * Created: 19 October 2026
+ * Author: Diaa Ahmed
+ * Description: Implementation file for the fixed-point scaling library.
+ * 
+ * This file contains the ratio helpers that need an integer division. They are meant for
+ * initialization or slow paths; the per-sample conversions are the inline functions of Fxp.h.
+ */
+
+#include <stdint-gcc.h>
+#include "Fxp.h"
+
+/**************************************************************
+ * Description: Scales a value by the ratio Num / Den with rounding.
+ * Parameters:
+ *   - Value: Input value.
+ *   - Num: Ratio numerator.
+ *   - Den: Ratio denominator, not 0.
+ * Outputs:
+ *   - uint32_t: round(Value * Num / Den), 0xFFFFFFFF for Den = 0.
+ * Note:
+ *   - Uses one integer division; for a fixed ratio precompute a factor with
+ *     Fxp_Reciprocal and use Fxp_MulShift in the hot path.
+ **************************************************************/
+uint32_t Fxp_ScaleRatio(uint16_t Value, uint16_t Num, uint16_t Den)
+{
+    uint32_t Product = (uint32_t)Value * Num;
+
+    if (Den == 0u)
+    {
+        return 0xFFFFFFFFu;
+    }
+    /* Product <= 65535^2 = 2^32 - 131071, adding Den / 2 cannot overflow */
+    return (Product + (Den >> 1)) / Den;
+}
+
+/**************************************************************
+ * Description: Computes the fixed-point factor of the ratio Num / Den.
+ * Parameters:
+ *   - Num: Ratio numerator.
+ *   - Den: Ratio denominator, not 0.
+ *   - Shift: Fractional bits of the factor.
+ * Outputs:
+ *   - uint32_t: round(Num * 2^Shift / Den), saturated to 32 bits.
+ **************************************************************/
+uint32_t Fxp_Reciprocal(uint16_t Num, uint16_t Den, uint8_t Shift)
+{
+    uint32_t Quotient, Remainder;
+    uint8_t i;
+
+    if (Den == 0u)
+    {
+        return 0xFFFFFFFFu;
+    }
+
+    /* Long division one fractional bit at a time, so Num << Shift never has to fit in 32 bits */
+    Quotient = Num / Den;
+    Remainder = Num % Den;
+    for (i = 0u; i < Shift; i++)
+    {
+        if (Quotient & 0x80000000u)
+        {
+            return 0xFFFFFFFFu;
+        }
+        Remainder <<= 1;
+        Quotient <<= 1;
+        if (Remainder >= Den)
+        {
+            Remainder -= Den;
+            Quotient |= 1u;
+        }
+    }
+    /* Round on the next bit */
+    if ((Remainder << 1) >= Den)
+    {
+        if (Quotient == 0xFFFFFFFFu)
+        {
+            return Quotient;
+        }
+        Quotient++;
+    }
+    return Quotient;
+}
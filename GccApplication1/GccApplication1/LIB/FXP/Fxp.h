@@ -0,0 +1,121 @@
+/*
+ * Fxp.h
+ *
+ * Created: 19 October 2026
+ * Author: Diaa Ahmed
+ * Description: Header file for the fixed-point scaling library.
+ * 
+ * This file contains integer replacements for the floating-point scaling used between the
+ * ADC, the PWM module and the display: rounded ratio scaling, mapping of 10 bit ADC results
+ * to N bit ranges and duty cycle to percent conversion. The mappings are inline so that a
+ * constant bit count folds into shifts; nothing here pulls soft-float routines into the image.
+ * 
+ * Duty cycles use the AUTOSAR scale 0x0000 (0 %) .. 0x8000 (100 %) of the PWM module.
+ */ 
+
+#ifndef FXP_H_
+#define FXP_H_
+
+#include <stdint.h>
+
+/* Full scale of a 10 bit ADC result */
+#define FXP_ADC10_MAX       (1023u)
+
+/* Duty cycle scale */
+#define FXP_DUTY_100        (0x8000u)
+
+/**************************************************************
+ * Description: Maps a 10 bit ADC result onto 0..2^Bits with rounding.
+ * Parameters:
+ *   - Adc: 0..1023.
+ *   - Bits: 1..15, 1023 maps to exactly 2^Bits; larger values are clamped to 15.
+ * Outputs:
+ *   - uint16_t: round(Adc * 2^Bits / 1023).
+ * Note:
+ *   - 1 / 1023 is expanded as (1 + 1/1024) / 1024, which is exact for every 10 bit input
+ *     with the 512 rounding constant, so no division is needed.
+ *   - 2^16 does not fit the result, so Bits stops at 15. The clamp folds away for a
+ *     constant Bits.
+ **************************************************************/
+static inline uint16_t Fxp_Adc10ToN(uint16_t Adc, uint8_t Bits)
+{
+    uint32_t Scaled;
+
+    if (Bits > 15u)
+    {
+        Bits = 15u;
+    }
+    Scaled = (uint32_t)Adc << Bits;
+
+    return (uint16_t)((Scaled + (Scaled >> 10) + 512u) >> 10);
+}
+
+/**************************************************************
+ * Description: Maps a 10 bit ADC result onto a duty cycle.
+ * Parameters:
+ *   - Adc: 0..1023.
+ * Outputs:
+ *   - uint16_t: 0x0000..0x8000.
+ **************************************************************/
+static inline uint16_t Fxp_Adc10ToDuty(uint16_t Adc)
+{
+    return Fxp_Adc10ToN(Adc, 15u);
+}
+
+/**************************************************************
+ * Description: Converts a duty cycle into a rounded percentage.
+ * Parameters:
+ *   - Duty: 0x0000..0x8000.
+ * Outputs:
+ *   - uint8_t: 0..100.
+ **************************************************************/
+static inline uint8_t Fxp_DutyToPercent(uint16_t Duty)
+{
+    return (uint8_t)(((uint32_t)Duty * 100u + 0x4000u) >> 15);
+}
+
+/**************************************************************
+ * Description: Multiplies by a fixed-point factor with rounding.
+ * Parameters:
+ *   - Value: Input value.
+ *   - Factor: Ratio scaled by 2^Shift, see Fxp_Reciprocal.
+ *   - Shift: 1..31.
+ * Outputs:
+ *   - uint32_t: round(Value * Factor / 2^Shift).
+ * Note:
+ *   - Value * Factor must fit in 32 bits.
+ **************************************************************/
+static inline uint32_t Fxp_MulShift(uint32_t Value, uint32_t Factor, uint8_t Shift)
+{
+    return (Value * Factor + ((uint32_t)1u << (Shift - 1u))) >> Shift;
+}
+
+/* Function prototypes */
+
+/**************************************************************
+ * Description: Scales a value by the ratio Num / Den with rounding.
+ * Parameters:
+ *   - Value: Input value.
+ *   - Num: Ratio numerator.
+ *   - Den: Ratio denominator, not 0.
+ * Outputs:
+ *   - uint32_t: round(Value * Num / Den), 0xFFFFFFFF for Den = 0.
+ * Note:
+ *   - Uses one integer division; for a fixed ratio precompute a factor with
+ *     Fxp_Reciprocal and use Fxp_MulShift in the hot path.
+ **************************************************************/
+extern uint32_t Fxp_ScaleRatio(uint16_t Value, uint16_t Num, uint16_t Den);
+
+/**************************************************************
+ * Description: Computes the fixed-point factor of the ratio Num / Den.
+ * Parameters:
+ *   - Num: Ratio numerator.
+ *   - Den: Ratio denominator, not 0.
+ *   - Shift: Fractional bits of the factor.
+ * Outputs:
+ *   - uint32_t: round(Num * 2^Shift / Den), saturated to 32 bits.
+ **************************************************************/
+extern uint32_t Fxp_Reciprocal(uint16_t Num, uint16_t Den, uint8_t Shift);
+
+
+#endif /* FXP_H_ */
@@ -0,0 +1,191 @@
+/*
+ * Adc.c
+ *
+ * Created: 19 October 2026
+ * Author: Diaa Ahmed
+ * Description: Implementation file for the ADC module.
+ * 
+ * This file contains the implementation of the interrupt driven ADC driver. The conversion
+ * complete ISR writes the sample into the current fill buffer and the latest value, and on
+ * a full block swaps the buffers and marks the full one as ready.
+ * 
+ * Note: This file is part of the AUTOSAR-compliant implementation and should not be
+ * modified without careful consideration of the impact on the entire system.
+ */
+
+#include <stdint-gcc.h>
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include "../DIO/Dio.h"
+#include "Adc_Cfg.h"
+#include "Adc.h"
+
+/* Block buffers, the ISR fills Adc_Buffer[Adc_Fill] */
+static uint16_t Adc_Buffer[2][ADC_BLOCK_SIZE];
+static uint8_t Adc_Fill;
+static uint8_t Adc_Index;
+
+/* Latest sample and its sequence counter */
+static volatile uint16_t Adc_Latest;
+static volatile uint8_t Adc_Sequence;
+
+/* Bit per buffer: block ready and not yet taken */
+static volatile uint8_t Adc_Ready;
+static volatile uint8_t Adc_Overruns;
+static volatile Adc_NotificationType Adc_Notification;
+
+/**************************************************************
+ * Description: Initializes the ADC and starts the conversions.
+ * Parameters:
+ *   - None
+ * Outputs:
+ *   - None
+ *   - AVCC reference, ADC_CHANNEL_ID, auto trigger from ADC_TRIGGER_SOURCE.
+ *   - Configures the channel pin as input.
+ * Reentrancy: 
+ *   - Non-Reentrant
+ * Note:
+ *   - Global interrupts must be enabled for the samples to be stored.
+ **************************************************************/
+void Adc_Init(void)
+{
+    Dio_InitChannel(ADC_CHANNEL_ID + 1u, DIO_INPUT);
+
+    Adc_Fill = 0u;
+    Adc_Index = 0u;
+    Adc_Ready = 0u;
+    Adc_Overruns = 0u;
+    Adc_Latest = 0u;
+    Adc_Notification = 0;
+
+    ADMUX = (1u << REFS0) | (ADC_CHANNEL_ID & 0x07u);    /* AVCC as reference voltage */
+    SFIOR = (SFIOR & 0x1Fu) | (ADC_TRIGGER_SOURCE << ADTS0);
+    ADCSRA = (1u << ADEN) | (1u << ADSC) | (1u << ADATE) | (1u << ADIF) | (1u << ADIE)
+           | ADC_PRESCALER_BITS;
+}
+
+/**************************************************************
+ * Description: Returns the latest converted sample.
+ * Parameters:
+ *   - None
+ * Outputs:
+ *   - uint16_t: 10 bit result of the most recent conversion.
+ * Reentrancy: 
+ *   - Reentrant
+ **************************************************************/
+uint16_t Adc_GetLatest(void)
+{
+    uint8_t Sequence;
+    uint16_t Value;
+
+    do
+    {
+        Sequence = Adc_Sequence;
+        Value = Adc_Latest;
+    } while (Sequence != Adc_Sequence);
+    return Value;
+}
+
+/**************************************************************
+ * Description: Returns the block completed since the last call.
+ * Parameters:
+ *   - None
+ * Outputs:
+ *   - const uint16_t*: ADC_BLOCK_SIZE samples, or 0 if no new block is ready.
+ * Reentrancy: 
+ *   - Non-Reentrant
+ * Note:
+ *   - The block stays valid until the ISR has filled the other buffer, that is for
+ *     ADC_BLOCK_SIZE conversion times. Adc_GetOverruns counts blocks that were not taken.
+ **************************************************************/
+const uint16_t* Adc_GetReadyBlock(void)
+{
+    uint8_t Ready, Sreg = SREG;
+
+    cli();
+    Ready = Adc_Ready;
+    Adc_Ready = 0u;
+    SREG = Sreg;
+
+    if (Ready == 0u)
+    {
+        return 0;
+    }
+    return (Ready & 1u) ? Adc_Buffer[0] : Adc_Buffer[1];
+}
+
+/**************************************************************
+ * Description: Returns the number of blocks completed while the previous one was not taken.
+ * Parameters:
+ *   - None
+ * Outputs:
+ *   - uint8_t: Overrun count (wraps).
+ * Reentrancy: 
+ *   - Reentrant
+ **************************************************************/
+uint8_t Adc_GetOverruns(void)
+{
+    return Adc_Overruns;
+}
+
+/**************************************************************
+ * Description: Enables the block ready notification.
+ * Parameters:
+ *   - Notification: Callback, called from the ADC ISR with the full block.
+ * Outputs:
+ *   - None
+ * Reentrancy: 
+ *   - Non-Reentrant
+ **************************************************************/
+void Adc_EnableNotification(Adc_NotificationType Notification)
+{
+    uint8_t Sreg = SREG;
+
+    cli();
+    Adc_Notification = Notification;
+    SREG = Sreg;
+}
+
+/**************************************************************
+ * Description: Disables the block ready notification.
+ * Parameters:
+ *   - None
+ * Outputs:
+ *   - None
+ * Reentrancy: 
+ *   - Non-Reentrant
+ **************************************************************/
+void Adc_DisableNotification(void)
+{
+    Adc_EnableNotification(0);
+}
+
+ISR(ADC_vect)
+{
+    uint16_t Sample = ADC;
+    Adc_NotificationType Notification;
+
+    Adc_Latest = Sample;
+    Adc_Sequence++;
+
+    Adc_Buffer[Adc_Fill][Adc_Index] = Sample;
+    if (++Adc_Index < ADC_BLOCK_SIZE)
+    {
+        return;
+    }
+
+    /* Block full: offer it and continue in the other buffer */
+    if (Adc_Ready)
+    {
+        Adc_Overruns++;
+    }
+    Adc_Ready = (uint8_t)(1u << Adc_Fill);
+    Adc_Fill ^= 1u;
+    Adc_Index = 0u;
+
+    Notification = Adc_Notification;
+    if (Notification)
+    {
+        Notification(Adc_Buffer[Adc_Fill ^ 1u]);
+    }
+}
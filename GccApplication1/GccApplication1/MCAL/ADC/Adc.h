@@ -0,0 +1,104 @@
+/*
+ * Adc.h
+ *
+ * Created: 19 October 2026
+ * Author: Diaa Ahmed
+ * Description: AUTOSAR-compliant header file for the ADC module.
+ * 
+ * This file contains the declarations and prototypes for the ADC module. The converter runs
+ * in free running or auto triggered mode and the conversion complete ISR stores every sample
+ * into one of two block buffers. When a block is full the buffers are swapped, the full
+ * block is offered to the application and the optional notification is called. The latest
+ * sample is published through a sequence counter and can be read at any time without
+ * waiting for a conversion or disabling interrupts, so sampling continues while the GLCD
+ * is redrawn.
+ * 
+ * Note: This file is part of the AUTOSAR-compliant implementation and should not be modified
+ * without careful consideration of the impact on the entire system.
+ */ 
+
+#ifndef ADC_H_
+#define ADC_H_
+
+#include <stdint.h>
+
+/* Type definition for the block ready notification, called from the ADC ISR */
+typedef void (*Adc_NotificationType)(const uint16_t* Block);
+
+/* Function prototypes */
+
+/**************************************************************
+ * Description: Initializes the ADC and starts the conversions.
+ * Parameters:
+ *   - None
+ * Outputs:
+ *   - None
+ *   - AVCC reference, ADC_CHANNEL_ID, auto trigger from ADC_TRIGGER_SOURCE.
+ *   - Configures the channel pin as input.
+ * Reentrancy: 
+ *   - Non-Reentrant
+ * Note:
+ *   - Global interrupts must be enabled for the samples to be stored.
+ **************************************************************/
+extern void Adc_Init(void);
+
+/**************************************************************
+ * Description: Returns the latest converted sample.
+ * Parameters:
+ *   - None
+ * Outputs:
+ *   - uint16_t: 10 bit result of the most recent conversion.
+ * Reentrancy: 
+ *   - Reentrant
+ **************************************************************/
+extern uint16_t Adc_GetLatest(void);
+
+/**************************************************************
+ * Description: Returns the block completed since the last call.
+ * Parameters:
+ *   - None
+ * Outputs:
+ *   - const uint16_t*: ADC_BLOCK_SIZE samples, or 0 if no new block is ready.
+ * Reentrancy: 
+ *   - Non-Reentrant
+ * Note:
+ *   - The block stays valid until the ISR has filled the other buffer, that is for
+ *     ADC_BLOCK_SIZE conversion times. Adc_GetOverruns counts blocks that were not taken.
+ **************************************************************/
+extern const uint16_t* Adc_GetReadyBlock(void);
+
+/**************************************************************
+ * Description: Returns the number of blocks completed while the previous one was not taken.
+ * Parameters:
+ *   - None
+ * Outputs:
+ *   - uint8_t: Overrun count (wraps).
+ * Reentrancy: 
+ *   - Reentrant
+ **************************************************************/
+extern uint8_t Adc_GetOverruns(void);
+
+/**************************************************************
+ * Description: Enables the block ready notification.
+ * Parameters:
+ *   - Notification: Callback, called from the ADC ISR with the full block.
+ * Outputs:
+ *   - None
+ * Reentrancy: 
+ *   - Non-Reentrant
+ **************************************************************/
+extern void Adc_EnableNotification(Adc_NotificationType Notification);
+
+/**************************************************************
+ * Description: Disables the block ready notification.
+ * Parameters:
+ *   - None
+ * Outputs:
+ *   - None
+ * Reentrancy: 
+ *   - Non-Reentrant
+ **************************************************************/
+extern void Adc_DisableNotification(void);
+
+
+#endif /* ADC_H_ */
@@ -0,0 +1,31 @@
+/*
+ * Adc_Cfg.h
+ *
+ * Created: 19 October 2026
+ * Author: Diaa Ahmed
+ * Description: AUTOSAR-compliant configuration header file for the ADC module.
+ * 
+ * This file contains the converted channel, the ADC clock prescaler, the trigger source and
+ * the size of the sample blocks. With F_CPU = 8 MHz and a prescaler of 128 one conversion
+ * takes 13 ADC clocks = 208 us, so a block of 16 samples is ready every 3.3 ms.
+ * 
+ * Note: This file is part of the AUTOSAR-compliant implementation and should not be modified
+ * without careful consideration of the impact on the entire system.
+ */
+
+#ifndef ADC_CFG_H_
+#define ADC_CFG_H_
+
+/* Converted channel (ADC0..ADC7) */
+#define ADC_CHANNEL_ID          (0u)
+
+/* ADPS2:0 clock prescaler bits, 7 = F_CPU / 128 */
+#define ADC_PRESCALER_BITS      (7u)
+
+/* ADTS2:0 auto trigger source, 0 = free running, 3 = Timer0 compare, 4 = Timer0 overflow */
+#define ADC_TRIGGER_SOURCE      (0u)
+
+/* Samples per block, each of the two block buffers holds this many samples */
+#define ADC_BLOCK_SIZE          (16u)
+
+#endif /* ADC_CFG_H_ */
@@ -0,0 +1,253 @@
+/*
+ * Icu.c
+ *
+ * Created: 19 October 2026
+ * Author: Diaa Ahmed
+ * Description: Implementation file for the ICU module.
+ * 
+ * This file contains the implementation of the Timer1 input capture measurement. A period
+ * is accepted after a rising, a falling and the next rising edge; its length and high time
+ * are accumulated until ICU_AVERAGE_PERIODS periods are collected and then published.
+ * Pulses shorter than the capture ISR latency cannot be toggled in time; the resulting
+ * inconsistent periods (high time not below the period) are discarded.
+ * 
+ * Note: This file is part of the AUTOSAR-compliant implementation and should not be
+ * modified without careful consideration of the impact on the entire system.
+ */
+
+#include <stdint-gcc.h>
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#ifndef F_CPU
+#define F_CPU 8000000UL
+#endif
+#include "../PWM/Pwm_Cfg.h"
+#include "../SOFTPWM/SoftPwm_Cfg.h"
+#include "Icu_Types.h"
+#include "Icu_Cfg.h"
+#include "Icu.h"
+
+#if ICU_USED
+
+#if PWM_TIMER1_USED
+#error "Icu needs Timer1 in normal mode, disable the Timer1 PWM channels"
+#endif
+
+/* Timer1 clock select bits CS12:0 of the prescaler */
+#if ICU_TIMER1_PRESCALER == 1u
+#define ICU_TIMER1_CS           (1u)
+#elif ICU_TIMER1_PRESCALER == 8u
+#define ICU_TIMER1_CS           (2u)
+#elif ICU_TIMER1_PRESCALER == 64u
+#define ICU_TIMER1_CS           (3u)
+#elif ICU_TIMER1_PRESCALER == 256u
+#define ICU_TIMER1_CS           (4u)
+#elif ICU_TIMER1_PRESCALER == 1024u
+#define ICU_TIMER1_CS           (5u)
+#else
+#error "ICU_TIMER1_PRESCALER must be 1, 8, 64, 256 or 1024"
+#endif
+
+/* The software PWM runs on the same free running Timer1 and sets its clock too */
+#if SOFTPWM_USED && (ICU_TIMER1_CS != SOFTPWM_TIMER1_CS)
+#error "ICU_TIMER1_PRESCALER does not match SOFTPWM_TIMER1_CS"
+#endif
+
+#if (ICU_AVERAGE_PERIODS < 1u) || (ICU_AVERAGE_PERIODS > 16u)
+#error "ICU_AVERAGE_PERIODS must be 1..16"
+#endif
+
+/* Timer1 clock and the dividend of the frequency in 0.1 Hz, must fit in 32 bits */
+#define ICU_TIMER_HZ            (F_CPU / ICU_TIMER1_PRESCALER)
+#define ICU_FREQ_DIVIDEND       ((uint32_t)ICU_TIMER_HZ * 10u * ICU_AVERAGE_PERIODS)
+
+#if (F_CPU / ICU_TIMER1_PRESCALER) * 10u * ICU_AVERAGE_PERIODS > 0xFFFFFFFFu
+#error "ICU_AVERAGE_PERIODS too large for the Timer1 clock"
+#endif
+
+/* Published snapshot and its sequence counter */
+static volatile Icu_SnapshotType Icu_Published;
+static volatile uint8_t Icu_Sequence;
+
+/* Capture state, only accessed by the ISRs */
+static uint16_t Icu_OverflowCount;
+static uint8_t Icu_IdleOverflows;
+static uint32_t Icu_LastRise;
+static uint32_t Icu_LastFall;
+static uint8_t Icu_HaveRise;
+static uint8_t Icu_HaveFall;
+static uint32_t Icu_PeriodAcc;
+static uint32_t Icu_HighAcc;
+static uint8_t Icu_PeriodCount;
+
+static void Icu_Publish(uint32_t PeriodSum, uint32_t HighSum, uint8_t Level)
+{
+    Icu_Published.PeriodSum = PeriodSum;
+    Icu_Published.HighSum = HighSum;
+    Icu_Published.Level = Level;
+    Icu_Sequence++;
+}
+
+/**************************************************************
+ * Description: Initializes Timer1 and starts the measurement.
+ * Parameters:
+ *   - None
+ * Outputs:
+ *   - None
+ *   - Configures ICP1 (PD6) as input, Timer1 in normal mode with the capture and
+ *     overflow interrupts enabled.
+ * Reentrancy: 
+ *   - Non-Reentrant
+ * Note:
+ *   - Global interrupts must be enabled for the measurement to run.
+ **************************************************************/
+void Icu_Init(void)
+{
+    DDRD &= ~(1u << 6);
+
+    Icu_OverflowCount = 0u;
+    Icu_IdleOverflows = 0u;
+    Icu_HaveRise = 0u;
+    Icu_HaveFall = 0u;
+    Icu_PeriodAcc = 0u;
+    Icu_HighAcc = 0u;
+    Icu_PeriodCount = 0u;
+    Icu_Publish(0u, 0u, 0u);
+
+    /* Normal mode, noise canceler on, first capture on a rising edge */
+    TCCR1A &= ~((1u << WGM11) | (1u << WGM10));
+    TCCR1B = (TCCR1B & ~((1u << WGM13) | (1u << WGM12) | 0x07u))
+           | (1u << ICNC1) | (1u << ICES1) | ICU_TIMER1_CS;
+    TIFR = (1u << ICF1) | (1u << TOV1);
+    TIMSK |= (1u << TICIE1) | (1u << TOIE1);
+}
+
+/**************************************************************
+ * Description: Copies the latest published measurement.
+ * Parameters:
+ *   - Snapshot: Destination of the copy.
+ * Outputs:
+ *   - None
+ *   - Retries the copy if the capture ISR published a new value meanwhile.
+ * Reentrancy: 
+ *   - Reentrant
+ **************************************************************/
+void Icu_GetSnapshot(Icu_SnapshotType* Snapshot)
+{
+    uint8_t Sequence;
+
+    do
+    {
+        Sequence = Icu_Sequence;
+        Snapshot->PeriodSum = Icu_Published.PeriodSum;
+        Snapshot->HighSum = Icu_Published.HighSum;
+        Snapshot->Level = Icu_Published.Level;
+    } while (Sequence != Icu_Sequence);
+}
+
+/**************************************************************
+ * Description: Converts the latest measurement into display units.
+ * Parameters:
+ *   - Measurement: Frequency in 0.1 Hz and duty cycle in 0x0000..0x8000.
+ * Outputs:
+ *   - None
+ *   - A constant input gives 0 Hz and 0 % or 100 % duty.
+ * Reentrancy: 
+ *   - Reentrant
+ * Note:
+ *   - The divisions are done here, in the caller's context, not in the ISRs.
+ **************************************************************/
+void Icu_GetMeasurement(Icu_MeasurementType* Measurement)
+{
+    Icu_SnapshotType Snapshot;
+    uint32_t Period, High;
+
+    Icu_GetSnapshot(&Snapshot);
+    Period = Snapshot.PeriodSum;
+    High = Snapshot.HighSum;
+
+    if (Period == 0u)
+    {
+        Measurement->FrequencyDeciHz = 0u;
+        Measurement->DutyCycle = Snapshot.Level ? 0x8000u : 0x0000u;
+        return;
+    }
+
+    Measurement->FrequencyDeciHz = ICU_FREQ_DIVIDEND / Period;
+
+    /* Scale both sums to 16 bits so that High << 15 fits in 32 bits */
+    while (Period > 0xFFFFu)
+    {
+        Period >>= 1;
+        High >>= 1;
+    }
+    Measurement->DutyCycle = (uint16_t)((High << 15) / Period);
+}
+
+ISR(TIMER1_OVF_vect)
+{
+    Icu_OverflowCount++;
+    if (Icu_IdleOverflows < ICU_TIMEOUT_OVERFLOWS)
+    {
+        if (++Icu_IdleOverflows == ICU_TIMEOUT_OVERFLOWS)
+        {
+            /* No edges: constant level, restart the period sequence */
+            Icu_HaveRise = 0u;
+            Icu_HaveFall = 0u;
+            Icu_PeriodAcc = 0u;
+            Icu_HighAcc = 0u;
+            Icu_PeriodCount = 0u;
+            Icu_Publish(0u, 0u, (PIND & (1u << 6)) ? 1u : 0u);
+        }
+    }
+}
+
+ISR(TIMER1_CAPT_vect)
+{
+    uint16_t Capture = ICR1;
+    uint16_t Upper = Icu_OverflowCount;
+    uint8_t Rising = (TCCR1B & (1u << ICES1)) ? 1u : 0u;
+    uint32_t Time, Period, High;
+
+    /* An overflow pending from before the capture belongs to this timestamp */
+    if ((TIFR & (1u << TOV1)) && (Capture < 0x8000u))
+    {
+        Upper++;
+    }
+    Time = ((uint32_t)Upper << 16) | Capture;
+
+    /* Wait for the opposite edge next; ICF1 must be cleared after changing the edge */
+    TCCR1B ^= (1u << ICES1);
+    TIFR = (1u << ICF1);
+    Icu_IdleOverflows = 0u;
+
+    if (!Rising)
+    {
+        Icu_LastFall = Time;
+        Icu_HaveFall = Icu_HaveRise;
+        return;
+    }
+
+    if (Icu_HaveFall)
+    {
+        Period = Time - Icu_LastRise;
+        High = Icu_LastFall - Icu_LastRise;
+        if (High < Period)
+        {
+            Icu_PeriodAcc += Period;
+            Icu_HighAcc += High;
+            if (++Icu_PeriodCount == ICU_AVERAGE_PERIODS)
+            {
+                Icu_Publish(Icu_PeriodAcc, Icu_HighAcc, 0u);
+                Icu_PeriodAcc = 0u;
+                Icu_HighAcc = 0u;
+                Icu_PeriodCount = 0u;
+            }
+        }
+    }
+    Icu_LastRise = Time;
+    Icu_HaveRise = 1u;
+    Icu_HaveFall = 0u;
+}
+
+#endif /* ICU_USED */
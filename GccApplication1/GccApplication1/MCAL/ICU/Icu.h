@@ -0,0 +1,68 @@
+/*
+ * Icu.h
+ *
+ * Created: 19 October 2026
+ * Author: Diaa Ahmed
+ * Description: AUTOSAR-compliant header file for the ICU module.
+ * 
+ * This file contains the declarations and prototypes for the ICU module, which measures the
+ * frequency and duty cycle of the signal on ICP1 with the Timer1 input capture unit. The
+ * capture interrupt toggles the edge after every capture and extends the timestamps to 32
+ * bits with the overflow count. Every ICU_AVERAGE_PERIODS periods the sums are published
+ * through a sequence counter, so the application reads a consistent snapshot without
+ * disabling interrupts and the render loop never waits on the measurement.
+ * 
+ * Note: This file is part of the AUTOSAR-compliant implementation and should not be modified
+ * without careful consideration of the impact on the entire system.
+ */ 
+
+#ifndef ICU_H_
+#define ICU_H_
+
+#include "Icu_Types.h"
+
+/* Function prototypes */
+
+/**************************************************************
+ * Description: Initializes Timer1 and starts the measurement.
+ * Parameters:
+ *   - None
+ * Outputs:
+ *   - None
+ *   - Configures ICP1 (PD6) as input, Timer1 in normal mode with the capture and
+ *     overflow interrupts enabled.
+ * Reentrancy: 
+ *   - Non-Reentrant
+ * Note:
+ *   - Global interrupts must be enabled for the measurement to run.
+ **************************************************************/
+extern void Icu_Init(void);
+
+/**************************************************************
+ * Description: Copies the latest published measurement.
+ * Parameters:
+ *   - Snapshot: Destination of the copy.
+ * Outputs:
+ *   - None
+ *   - Retries the copy if the capture ISR published a new value meanwhile.
+ * Reentrancy: 
+ *   - Reentrant
+ **************************************************************/
+extern void Icu_GetSnapshot(Icu_SnapshotType* Snapshot);
+
+/**************************************************************
+ * Description: Converts the latest measurement into display units.
+ * Parameters:
+ *   - Measurement: Frequency in 0.1 Hz and duty cycle in 0x0000..0x8000.
+ * Outputs:
+ *   - None
+ *   - A constant input gives 0 Hz and 0 % or 100 % duty.
+ * Reentrancy: 
+ *   - Reentrant
+ * Note:
+ *   - The divisions are done here, in the caller's context, not in the ISRs.
+ **************************************************************/
+extern void Icu_GetMeasurement(Icu_MeasurementType* Measurement);
+
+
+#endif /* ICU_H_ */
@@ -0,0 +1,36 @@
+/*
+ * Icu_Cfg.h
+ *
+ * Created: 19 October 2026
+ * Author: Diaa Ahmed
+ * Description: AUTOSAR-compliant configuration header file for the ICU module.
+ * 
+ * This file contains the Timer1 clock, the number of periods averaged per measurement and
+ * the timeout after which a missing signal is reported.
+ * 
+ * Timer1 runs free in normal mode and is shared with the software PWM module; when both
+ * are used the prescaler must match SOFTPWM_TIMER1_CS, Icu.c refuses to build otherwise.
+ * ICP1 (PD6) is GLCD data line D7 on the reference board, so the measurement is not shown
+ * unless ICU_USED is set on a board with ICP1 wired to the PWM output.
+ * 
+ * Note: This file is part of the AUTOSAR-compliant implementation and should not be modified
+ * without careful consideration of the impact on the entire system.
+ */
+
+#ifndef ICU_CFG_H_
+#define ICU_CFG_H_
+
+/* Measurement built in and shown by the application, it takes Timer1 and its capture and
+ * overflow vectors (1u = used, 0u = unused) */
+#define ICU_USED                (0u)
+
+/* Timer1 clock divider (1, 8, 64, 256, 1024) */
+#define ICU_TIMER1_PRESCALER    (1u)
+
+/* Periods averaged per published measurement (1..16) */
+#define ICU_AVERAGE_PERIODS     (8u)
+
+/* Timer1 overflows without an edge before the signal is reported as constant */
+#define ICU_TIMEOUT_OVERFLOWS   (4u)
+
+#endif /* ICU_CFG_H_ */
@@ -0,0 +1,35 @@
+/*
+ * Icu_Types.h
+ *
+ * Created: 19 October 2026
+ * Author: Diaa Ahmed
+ * Description: AUTOSAR-compliant types header file for the ICU module.
+ * 
+ * This file includes type definitions specific to the ICU (Input Capture Unit) module: the
+ * snapshot published by the capture interrupt and the measurement derived from it.
+ * 
+ * Note: This file is part of the AUTOSAR-compliant implementation and should not be modified
+ * without careful consideration of the impact on the entire system.
+ */
+
+
+#ifndef ICU_TYPES_H_
+#define ICU_TYPES_H_
+
+#include <stdint.h>  // Include standard integer types
+
+/* Type definition for the raw measurement published by the ISRs */
+typedef struct {
+	uint32_t PeriodSum;   /* Sum of ICU_AVERAGE_PERIODS periods in timer ticks, 0 if no signal */
+	uint32_t HighSum;     /* Sum of the high times of the same periods */
+	uint8_t Level;        /* Input level while no edges are seen */
+} Icu_SnapshotType;
+
+/* Type definition for the measurement in display units */
+typedef struct {
+	uint32_t FrequencyDeciHz;   /* Frequency in 0.1 Hz */
+	uint16_t DutyCycle;         /* 0x0000 (0 %) .. 0x8000 (100 %) */
+} Icu_MeasurementType;
+
+
+#endif /* ICU_TYPES_H_ */
@@ -0,0 +1,587 @@
+/*
+ * Pwm.c
+ *
+ * Created: 19 October 2026
+ * Author: Diaa Ahmed
+ * Description: Implementation file for the PWM module.
+ * 
+ * This file contains the implementation of the hardware PWM driver. Every used timer is
+ * configured from the timer table of Pwm_Config, and requests on logical channels are
+ * turned into pending compare values and COM bits which the timer overflow ISR copies
+ * into OCRx/TCCRx, so that updates are glitch-free. In fast PWM mode a compare match
+ * cannot produce 0 %, so the output compare pin is disconnected and driven to the
+ * inactive level by PORTx for a zero duty cycle.
+ * 
+ * Edge notifications are derived from the timer events: in fast PWM mode the active part
+ * of the period starts at the overflow and ends at the compare match, in phase correct
+ * mode it ends at the up-counting match and starts at the down-counting match.
+ * 
+ * Note: This file is part of the AUTOSAR-compliant implementation and should not be
+ * modified without careful consideration of the impact on the entire system.
+ */
+
+#include <stdint-gcc.h>
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#ifndef F_CPU
+#define F_CPU 8000000UL
+#endif
+#include "Pwm_Types.h"
+#include "Pwm_Cfg.h"
+#include "Pwm.h"
+
+/* Number of hardware PWM channels */
+#define PWM_MAX_HW_CHANNELS (4u)
+
+/* Bit in Pwm_PendingMask for a pending Timer1 TOP (ICR1) */
+#define PWM_PENDING_TOP1    (1u << 4)
+
+static const Pwm_ConfigType* Pwm_ConfigPtr;
+/* Channel configuration per hardware channel, 0 if the pin is not used */
+static const Pwm_ChannelConfigType* Pwm_HwConfig[PWM_MAX_HW_CHANNELS];
+/* Current TOP per timer and last requested duty per hardware channel */
+static uint16_t Pwm_Top[PWM_MAX_TIMERS];
+static uint16_t Pwm_Duty[PWM_MAX_HW_CHANNELS];
+
+/* Requests waiting for the next overflow */
+static volatile uint16_t Pwm_PendingCompare[PWM_MAX_HW_CHANNELS];
+static volatile uint8_t Pwm_PendingCom[PWM_MAX_HW_CHANNELS];
+static volatile uint16_t Pwm_PendingTop1;
+static volatile uint8_t Pwm_PendingMask;
+
+/* Bit per hardware channel: pin connected to the timer */
+static volatile uint8_t Pwm_Connected;
+/* Bit per hardware channel: next phase correct compare match is on the down slope */
+static volatile uint8_t Pwm_Slope;
+/* Enabled notification edges per hardware channel */
+static volatile uint8_t Pwm_NotifyEdges[PWM_MAX_HW_CHANNELS];
+
+static const Pwm_TimerType Pwm_HwTimer[PWM_MAX_HW_CHANNELS] = {
+	PWM_TIMER0, PWM_TIMER1, PWM_TIMER1, PWM_TIMER2
+};
+
+/* Position of COMx0, COMx1 is the next bit */
+static const uint8_t Pwm_ComShift[PWM_MAX_HW_CHANNELS] = {
+	COM00, COM1A0, COM1B0, COM20
+};
+
+/* Pin of each output compare channel, OC0 is on PORTB, the others on PORTD */
+static const uint8_t Pwm_HwPin[PWM_MAX_HW_CHANNELS] = {
+	3u, 5u, 4u, 7u
+};
+
+/* Bit per hardware channel enabled by PWM_OCx_USED, only those have their ISRs compiled */
+#define PWM_HW_USED_MASK    ((PWM_OC0_USED << PWM_OC0) | (PWM_OC1A_USED << PWM_OC1A) \
+                           | (PWM_OC1B_USED << PWM_OC1B) | (PWM_OC2_USED << PWM_OC2))
+
+/* Pwm_Init has run, the logical channel exists and was accepted by it */
+static uint8_t Pwm_ChannelValid(Pwm_ChannelType ChannelNumber)
+{
+    return (Pwm_ConfigPtr != 0) &&
+           (ChannelNumber < Pwm_ConfigPtr->NumChannels) &&
+           (Pwm_HwConfig[Pwm_ConfigPtr->Channels[ChannelNumber].HwChannel] != 0);
+}
+
+/* Converts a prescaler value into the CSx2:0 clock select bits */
+static uint8_t Pwm_ClockSelect(Pwm_TimerType Timer, uint16_t Prescaler)
+{
+    uint8_t ClockSelect = 1u;
+
+    if (Timer == PWM_TIMER2)
+    {
+        switch (Prescaler)
+        {
+            case 8u:    ClockSelect = 2u; break;
+            case 32u:   ClockSelect = 3u; break;
+            case 64u:   ClockSelect = 4u; break;
+            case 128u:  ClockSelect = 5u; break;
+            case 256u:  ClockSelect = 6u; break;
+            case 1024u: ClockSelect = 7u; break;
+            default:    ClockSelect = 1u; break;
+        }
+    }
+    else
+    {
+        switch (Prescaler)
+        {
+            case 8u:    ClockSelect = 2u; break;
+            case 64u:   ClockSelect = 3u; break;
+            case 256u:  ClockSelect = 4u; break;
+            case 1024u: ClockSelect = 5u; break;
+            default:    ClockSelect = 1u; break;
+        }
+    }
+    return ClockSelect;
+}
+
+/* Drives the pin level used while the channel is disconnected from the timer */
+static void Pwm_DrivePin(Pwm_HwChannelType Hw, Pwm_OutputStateType Level)
+{
+    volatile uint8_t* Port = (Hw == PWM_OC0) ? &PORTB : &PORTD;
+    uint8_t Mask = (uint8_t)(1u << Pwm_HwPin[Hw]);
+    uint8_t Sreg = SREG;
+
+    cli();
+    if (Level == PWM_HIGH)
+        *Port |= Mask;
+    else
+        *Port &= ~Mask;
+    SREG = Sreg;
+}
+
+static void Pwm_Request(Pwm_HwChannelType Hw, uint16_t Compare, uint8_t Com)
+{
+    uint8_t Sreg = SREG;
+
+    cli();
+    Pwm_PendingCompare[Hw] = Compare;
+    Pwm_PendingCom[Hw] = Com;
+    Pwm_PendingMask |= (1u << Hw);
+    SREG = Sreg;
+}
+
+/* Converts a duty cycle into a compare value for the current TOP and requests it */
+static void Pwm_ApplyDuty(Pwm_HwChannelType Hw, uint16_t DutyCycle)
+{
+    const Pwm_ChannelConfigType* Cfg = Pwm_HwConfig[Hw];
+    Pwm_TimerType Timer = Pwm_HwTimer[Hw];
+    uint16_t Top = Pwm_Top[Timer];
+    uint16_t Compare, Ticks;
+    uint8_t Com;
+
+    if (DutyCycle > PWM_DUTY_100)
+    {
+        DutyCycle = PWM_DUTY_100;
+    }
+    Pwm_Duty[Hw] = DutyCycle;
+
+    /* Non-inverting (COMx1) for an active high channel, inverting (COMx1|COMx0) otherwise */
+    Com = (uint8_t)(2u << Pwm_ComShift[Hw]);
+    if (Cfg->Polarity == PWM_LOW)
+    {
+        Com |= (uint8_t)(1u << Pwm_ComShift[Hw]);
+    }
+
+    if (Pwm_ConfigPtr->Timers[Timer].Mode == PWM_MODE_FAST)
+    {
+        /* Active for OCRx + 1 ticks out of TOP + 1 */
+        Ticks = (uint16_t)(((uint32_t)DutyCycle * ((uint32_t)Top + 1u)) >> 15);
+        if (Ticks == 0u)
+        {
+            Pwm_DrivePin(Hw, (Cfg->Polarity == PWM_HIGH) ? PWM_LOW : PWM_HIGH);
+            Pwm_Request(Hw, 0u, 0u);
+            return;
+        }
+        Compare = Ticks - 1u;
+    }
+    else
+    {
+        /* Active for OCRx out of TOP ticks on each slope */
+        Compare = (uint16_t)(((uint32_t)DutyCycle * Top) >> 15);
+    }
+    Pwm_Request(Hw, Compare, Com);
+}
+
+/* Calls the channel notification if the edge is enabled, ActiveBegins is the timer event */
+static inline void Pwm_Notify(Pwm_HwChannelType Hw, uint8_t ActiveBegins)
+{
+    const Pwm_ChannelConfigType* Cfg = Pwm_HwConfig[Hw];
+    uint8_t Edge;
+
+    if ((Pwm_NotifyEdges[Hw] == 0u) || !(Pwm_Connected & (1u << Hw)))
+    {
+        return;
+    }
+    Edge = ((ActiveBegins != 0u) == (Cfg->Polarity == PWM_HIGH)) ? PWM_RISING_EDGE : PWM_FALLING_EDGE;
+    if (Pwm_NotifyEdges[Hw] & Edge)
+    {
+        Cfg->Notification();
+    }
+}
+
+/* Compare match of a channel: end of the active part, or its start on the down slope */
+static inline void Pwm_CompareEdge(Pwm_HwChannelType Hw)
+{
+    if (Pwm_ConfigPtr->Timers[Pwm_HwTimer[Hw]].Mode == PWM_MODE_FAST)
+    {
+        Pwm_Notify(Hw, 0u);
+    }
+    else
+    {
+        Pwm_Notify(Hw, Pwm_Slope & (1u << Hw));
+        Pwm_Slope ^= (1u << Hw);
+    }
+}
+
+/* Overflow of a channel's timer: latches the pending request and reports the period start */
+static inline void Pwm_OverflowEdge(Pwm_HwChannelType Hw, volatile uint8_t* Tccr)
+{
+    uint8_t ComMask = (uint8_t)(3u << Pwm_ComShift[Hw]);
+
+    if (Pwm_PendingMask & (1u << Hw))
+    {
+        switch (Hw)
+        {
+            case PWM_OC0:  OCR0 = (uint8_t)Pwm_PendingCompare[Hw]; break;
+            case PWM_OC1A: OCR1A = Pwm_PendingCompare[Hw]; break;
+            case PWM_OC1B: OCR1B = Pwm_PendingCompare[Hw]; break;
+            case PWM_OC2:  OCR2 = (uint8_t)Pwm_PendingCompare[Hw]; break;
+        }
+        *Tccr = (*Tccr & ~ComMask) | Pwm_PendingCom[Hw];
+        if (Pwm_PendingCom[Hw] != 0u)
+            Pwm_Connected |= (1u << Hw);
+        else
+            Pwm_Connected &= ~(1u << Hw);
+        Pwm_PendingMask &= ~(1u << Hw);
+    }
+
+    if (Pwm_ConfigPtr->Timers[Pwm_HwTimer[Hw]].Mode == PWM_MODE_FAST)
+    {
+        Pwm_Notify(Hw, 1u);
+    }
+    else
+    {
+        Pwm_Slope &= ~(1u << Hw);
+    }
+}
+
+/* Enables or disables the compare match interrupt of a hardware channel */
+static void Pwm_CompareInterrupt(Pwm_HwChannelType Hw, uint8_t Enable)
+{
+    static const uint8_t Ocie[PWM_MAX_HW_CHANNELS] = {
+        (1u << OCIE0), (1u << OCIE1A), (1u << OCIE1B), (1u << OCIE2)
+    };
+    uint8_t Sreg = SREG;
+
+    cli();
+    if (Enable)
+        TIMSK |= Ocie[Hw];
+    else
+        TIMSK &= ~Ocie[Hw];
+    SREG = Sreg;
+}
+
+/**************************************************************
+ * Description: Initializes the timers and channels of the PWM module.
+ * Parameters:
+ *   - ConfigPtr: Pointer to the module configuration (Pwm_Config).
+ * Outputs:
+ *   - None
+ *   - Configures TCCRx, ICR1 and the overflow interrupt of every used timer.
+ *   - Configures the used OCx pins as outputs and applies the initial duty cycles.
+ *   - Channels on an OCx pin whose PWM_OCx_USED is 0 are ignored, later requests and
+ *     notifications on them are rejected.
+ * Conformance to AUTOSAR Standard: 
+ *   - Follows the AUTOSAR Pwm_Init API, notifications start disabled.
+ * Reentrancy: 
+ *   - Non-Reentrant
+ * Note:
+ *   - Global interrupts must be enabled for duty cycle updates to take effect.
+ **************************************************************/
+void Pwm_Init(const Pwm_ConfigType* ConfigPtr)
+{
+    uint8_t Channel, Hw;
+    const Pwm_TimerConfigType* Timers = ConfigPtr->Timers;
+
+    Pwm_ConfigPtr = ConfigPtr;
+    Pwm_PendingMask = 0u;
+    Pwm_Connected = 0u;
+    Pwm_Slope = 0u;
+    for (Hw = 0u; Hw < PWM_MAX_HW_CHANNELS; Hw++)
+    {
+        Pwm_HwConfig[Hw] = 0;
+        Pwm_NotifyEdges[Hw] = 0u;
+    }
+    Pwm_Top[PWM_TIMER0] = 0xFFu;
+    Pwm_Top[PWM_TIMER1] = Timers[PWM_TIMER1].Top;
+    Pwm_Top[PWM_TIMER2] = 0xFFu;
+
+#if PWM_TIMER0_USED
+    /* WGM00 selects phase correct, WGM01 adds fast; pin disconnected until the first overflow */
+    OCR0 = 0u;
+    TCCR0 = (1u << WGM00)
+          | ((Timers[PWM_TIMER0].Mode == PWM_MODE_FAST) ? (1u << WGM01) : 0u)
+          | Pwm_ClockSelect(PWM_TIMER0, Timers[PWM_TIMER0].Prescaler);
+    TIMSK |= (1u << TOIE0);
+#endif
+
+#if PWM_TIMER1_USED
+    /* Mode 14 (fast) or mode 8 (phase and frequency correct), both with TOP in ICR1.
+     * Mode 8 updates OCR1x at BOTTOM, where the overflow ISR also changes ICR1, so a new
+     * period never meets compare values latched for the old one. */
+    OCR1A = 0u;
+    OCR1B = 0u;
+    ICR1 = Timers[PWM_TIMER1].Top;
+    TCCR1A = (Timers[PWM_TIMER1].Mode == PWM_MODE_FAST) ? (1u << WGM11) : 0u;
+    TCCR1B = (1u << WGM13)
+           | ((Timers[PWM_TIMER1].Mode == PWM_MODE_FAST) ? (1u << WGM12) : 0u)
+           | Pwm_ClockSelect(PWM_TIMER1, Timers[PWM_TIMER1].Prescaler);
+    TIMSK |= (1u << TOIE1);
+#endif
+
+#if PWM_TIMER2_USED
+    OCR2 = 0u;
+    TCCR2 = (1u << WGM20)
+          | ((Timers[PWM_TIMER2].Mode == PWM_MODE_FAST) ? (1u << WGM21) : 0u)
+          | Pwm_ClockSelect(PWM_TIMER2, Timers[PWM_TIMER2].Prescaler);
+    TIMSK |= (1u << TOIE2);
+#endif
+
+    for (Channel = 0u; Channel < ConfigPtr->NumChannels; Channel++)
+    {
+        Hw = ConfigPtr->Channels[Channel].HwChannel;
+        if (!(PWM_HW_USED_MASK & (1u << Hw)))
+        {
+            /* Error: hardware channel not enabled by PWM_OCx_USED, its ISRs are not compiled */
+            continue;
+        }
+        Pwm_HwConfig[Hw] = &ConfigPtr->Channels[Channel];
+        if (Hw == PWM_OC0)
+            DDRB |= (1u << Pwm_HwPin[Hw]);
+        else
+            DDRD |= (1u << Pwm_HwPin[Hw]);
+        Pwm_ApplyDuty(Hw, ConfigPtr->Channels[Channel].DutyCycle);
+    }
+}
+
+/**************************************************************
+ * Description: Requests a new duty cycle for a channel.
+ * Parameters:
+ *   - ChannelNumber: Logical PWM channel.
+ *   - DutyCycle: 0x0000 (0 %) .. 0x8000 (100 %), larger values are clamped.
+ * Outputs:
+ *   - None
+ *   - The compare value is applied by the overflow ISR of the channel's timer.
+ *   - A 0 % duty in fast PWM mode disconnects the pin and drives the inactive level.
+ * Conformance to AUTOSAR Standard: 
+ *   - Follows the AUTOSAR Pwm_SetDutyCycle API.
+ * Reentrancy: 
+ *   - Reentrant for different channels.
+ **************************************************************/
+void Pwm_SetDutyCycle(Pwm_ChannelType ChannelNumber, uint16_t DutyCycle)
+{
+    if (!Pwm_ChannelValid(ChannelNumber))
+    {
+        /* Error: Invalid or unused channel */
+        return;
+    }
+    Pwm_ApplyDuty(Pwm_ConfigPtr->Channels[ChannelNumber].HwChannel, DutyCycle);
+}
+
+/**************************************************************
+ * Description: Requests a new period and duty cycle for a channel.
+ * Parameters:
+ *   - ChannelNumber: Logical PWM channel.
+ *   - Period: Period in timer ticks (TOP for fast PWM is Period - 1).
+ *   - DutyCycle: 0x0000 (0 %) .. 0x8000 (100 %).
+ * Outputs:
+ *   - None
+ *   - Only channels on Timer1 have a variable period (ICR1); the period is shared by
+ *     OC1A and OC1B and the duty cycle of the other channel is kept.
+ *   - On Timer0/Timer2 the period is ignored and only the duty cycle is set.
+ * Conformance to AUTOSAR Standard: 
+ *   - Follows the AUTOSAR Pwm_SetPeriodAndDuty API.
+ * Reentrancy: 
+ *   - Non-Reentrant
+ **************************************************************/
+void Pwm_SetPeriodAndDuty(Pwm_ChannelType ChannelNumber, Pwm_PeriodType Period, uint16_t DutyCycle)
+{
+    Pwm_HwChannelType Hw, Other;
+    uint16_t Top;
+    uint8_t Sreg;
+
+    if (!Pwm_ChannelValid(ChannelNumber))
+    {
+        /* Error: Invalid or unused channel */
+        return;
+    }
+
+    Hw = Pwm_ConfigPtr->Channels[ChannelNumber].HwChannel;
+    if ((Pwm_HwTimer[Hw] == PWM_TIMER1) && (Period >= 4u))
+    {
+        /* Phase correct counts up and down, the period is twice TOP */
+        if (Pwm_ConfigPtr->Timers[PWM_TIMER1].Mode == PWM_MODE_FAST)
+            Top = Period - 1u;
+        else
+            Top = Period >> 1;
+
+        Sreg = SREG;
+        cli();
+        Pwm_Top[PWM_TIMER1] = Top;
+        Pwm_PendingTop1 = Top;
+        Pwm_PendingMask |= PWM_PENDING_TOP1;
+        SREG = Sreg;
+
+        /* Keep the duty cycle of the other Timer1 channel at the new TOP */
+        Other = (Hw == PWM_OC1A) ? PWM_OC1B : PWM_OC1A;
+        if (Pwm_HwConfig[Other] != 0)
+        {
+            Pwm_ApplyDuty(Other, Pwm_Duty[Other]);
+        }
+    }
+    Pwm_ApplyDuty(Hw, DutyCycle);
+}
+
+/**************************************************************
+ * Description: Sets the output of a channel to its configured idle state.
+ * Parameters:
+ *   - ChannelNumber: Logical PWM channel.
+ * Outputs:
+ *   - None
+ *   - The pin is disconnected from the timer at the next overflow.
+ * Conformance to AUTOSAR Standard: 
+ *   - Follows the AUTOSAR Pwm_SetOutputToIdle API, the next Pwm_SetDutyCycle resumes the output.
+ * Reentrancy: 
+ *   - Reentrant for different channels.
+ **************************************************************/
+void Pwm_SetOutputToIdle(Pwm_ChannelType ChannelNumber)
+{
+    Pwm_HwChannelType Hw;
+
+    if (!Pwm_ChannelValid(ChannelNumber))
+    {
+        /* Error: Invalid or unused channel */
+        return;
+    }
+    Hw = Pwm_ConfigPtr->Channels[ChannelNumber].HwChannel;
+    Pwm_DrivePin(Hw, Pwm_ConfigPtr->Channels[ChannelNumber].IdleState);
+    Pwm_Request(Hw, 0u, 0u);
+}
+
+/**************************************************************
+ * Description: Enables the edge notification of a channel.
+ * Parameters:
+ *   - ChannelNumber: Logical PWM channel.
+ *   - Notification: PWM_RISING_EDGE, PWM_FALLING_EDGE or PWM_BOTH_EDGES.
+ * Outputs:
+ *   - None
+ *   - The configured callback is called from the timer ISR on the selected edges.
+ * Conformance to AUTOSAR Standard: 
+ *   - Follows the AUTOSAR Pwm_EnableNotification API.
+ * Reentrancy: 
+ *   - Reentrant for different channels.
+ **************************************************************/
+void Pwm_EnableNotification(Pwm_ChannelType ChannelNumber, Pwm_EdgeNotificationType Notification)
+{
+    Pwm_HwChannelType Hw;
+
+    if (!Pwm_ChannelValid(ChannelNumber) ||
+        (Pwm_ConfigPtr->Channels[ChannelNumber].Notification == 0))
+    {
+        /* Error: Invalid or unused channel, or no notification configured */
+        return;
+    }
+    Hw = Pwm_ConfigPtr->Channels[ChannelNumber].HwChannel;
+    Pwm_NotifyEdges[Hw] = (uint8_t)Notification;
+    Pwm_CompareInterrupt(Hw, 1u);
+}
+
+/**************************************************************
+ * Description: Disables the edge notification of a channel.
+ * Parameters:
+ *   - ChannelNumber: Logical PWM channel.
+ * Outputs:
+ *   - None
+ * Conformance to AUTOSAR Standard: 
+ *   - Follows the AUTOSAR Pwm_DisableNotification API.
+ * Reentrancy: 
+ *   - Reentrant for different channels.
+ **************************************************************/
+void Pwm_DisableNotification(Pwm_ChannelType ChannelNumber)
+{
+    Pwm_HwChannelType Hw;
+
+    if (!Pwm_ChannelValid(ChannelNumber))
+    {
+        /* Error: Invalid or unused channel */
+        return;
+    }
+    Hw = Pwm_ConfigPtr->Channels[ChannelNumber].HwChannel;
+    Pwm_CompareInterrupt(Hw, 0u);
+    Pwm_NotifyEdges[Hw] = 0u;
+}
+
+/**************************************************************
+ * Description: Returns the output frequency of a timer.
+ * Parameters:
+ *   - Timer: Timer identifier.
+ * Outputs:
+ *   - uint32_t: Frequency in Hz, computed from F_CPU, the prescaler, the mode and TOP;
+ *               0 before Pwm_Init.
+ * Reentrancy: 
+ *   - Reentrant
+ **************************************************************/
+uint32_t Pwm_GetFrequency(Pwm_TimerType Timer)
+{
+    uint32_t Divider;
+
+    if ((Pwm_ConfigPtr == 0) || (Timer >= PWM_MAX_TIMERS))
+    {
+        return 0u;
+    }
+    Divider = (uint32_t)Pwm_ConfigPtr->Timers[Timer].Prescaler;
+    if (Pwm_ConfigPtr->Timers[Timer].Mode == PWM_MODE_FAST)
+    {
+        Divider *= (uint32_t)Pwm_Top[Timer] + 1u;
+    }
+    else
+    {
+        Divider *= 2u * (uint32_t)Pwm_Top[Timer];
+    }
+    return (Divider != 0u) ? (F_CPU / Divider) : 0u;
+}
+
+#if PWM_TIMER0_USED
+ISR(TIMER0_OVF_vect)
+{
+    Pwm_OverflowEdge(PWM_OC0, &TCCR0);
+}
+
+ISR(TIMER0_COMP_vect)
+{
+    Pwm_CompareEdge(PWM_OC0);
+}
+#endif
+
+#if PWM_TIMER1_USED
+ISR(TIMER1_OVF_vect)
+{
+    if (Pwm_PendingMask & PWM_PENDING_TOP1)
+    {
+        ICR1 = Pwm_PendingTop1;
+        Pwm_PendingMask &= ~PWM_PENDING_TOP1;
+    }
+#if PWM_OC1A_USED
+    Pwm_OverflowEdge(PWM_OC1A, &TCCR1A);
+#endif
+#if PWM_OC1B_USED
+    Pwm_OverflowEdge(PWM_OC1B, &TCCR1A);
+#endif
+}
+
+#if PWM_OC1A_USED
+ISR(TIMER1_COMPA_vect)
+{
+    Pwm_CompareEdge(PWM_OC1A);
+}
+#endif
+
+#if PWM_OC1B_USED
+ISR(TIMER1_COMPB_vect)
+{
+    Pwm_CompareEdge(PWM_OC1B);
+}
+#endif
+#endif
+
+#if PWM_TIMER2_USED
+ISR(TIMER2_OVF_vect)
+{
+    Pwm_OverflowEdge(PWM_OC2, &TCCR2);
+}
+
+ISR(TIMER2_COMP_vect)
+{
+    Pwm_CompareEdge(PWM_OC2);
+}
+#endif
@@ -0,0 +1,176 @@
+/*
+ * Pwm.h
+ *
+ * Created: 19 October 2026
+ * Author: Diaa Ahmed
+ * Description: AUTOSAR-compliant header file for the PWM module.
+ * 
+ * This file contains the declarations and prototypes for the PWM module, which drives the
+ * hardware output compare pins OC0, OC1A, OC1B and OC2 of the ATmega32 in fast PWM or
+ * phase correct PWM mode. Logical channels are described by Pwm_ChannelConfig, duty cycles
+ * use the AUTOSAR fixed point scale 0x0000 (0 %) .. 0x8000 (100 %).
+ * 
+ * Duty cycle, period and idle requests are latched by the timer overflow interrupt so that
+ * a new value never takes effect in the middle of a period. Pwm_SetDutyCycleFast is the
+ * inline path for control loops, it writes the double-buffered OCRx register directly.
+ * 
+ * Note: This file is part of the AUTOSAR-compliant implementation and should not be modified
+ * without careful consideration of the impact on the entire system.
+ */ 
+
+#ifndef PWM_H_
+#define PWM_H_
+
+#include <avr/io.h>
+#include "Pwm_Types.h"
+
+/* Duty cycle scale */
+#define PWM_DUTY_0          (0x0000u)
+#define PWM_DUTY_100        (0x8000u)
+
+/* Function prototypes */
+
+/**************************************************************
+ * Description: Initializes the timers and channels of the PWM module.
+ * Parameters:
+ *   - ConfigPtr: Pointer to the module configuration (Pwm_Config).
+ * Outputs:
+ *   - None
+ *   - Configures TCCRx, ICR1 and the overflow interrupt of every used timer.
+ *   - Configures the used OCx pins as outputs and applies the initial duty cycles.
+ *   - Channels on an OCx pin whose PWM_OCx_USED is 0 are ignored, later requests and
+ *     notifications on them are rejected.
+ * Conformance to AUTOSAR Standard: 
+ *   - Follows the AUTOSAR Pwm_Init API, notifications start disabled.
+ * Reentrancy: 
+ *   - Non-Reentrant
+ * Note:
+ *   - Global interrupts must be enabled for duty cycle updates to take effect.
+ **************************************************************/
+extern void Pwm_Init(const Pwm_ConfigType* ConfigPtr);
+
+/**************************************************************
+ * Description: Requests a new duty cycle for a channel.
+ * Parameters:
+ *   - ChannelNumber: Logical PWM channel.
+ *   - DutyCycle: 0x0000 (0 %) .. 0x8000 (100 %), larger values are clamped.
+ * Outputs:
+ *   - None
+ *   - The compare value is applied by the overflow ISR of the channel's timer.
+ *   - A 0 % duty in fast PWM mode disconnects the pin and drives the inactive level.
+ * Conformance to AUTOSAR Standard: 
+ *   - Follows the AUTOSAR Pwm_SetDutyCycle API.
+ * Reentrancy: 
+ *   - Reentrant for different channels.
+ **************************************************************/
+extern void Pwm_SetDutyCycle(Pwm_ChannelType ChannelNumber, uint16_t DutyCycle);
+
+/**************************************************************
+ * Description: Requests a new period and duty cycle for a channel.
+ * Parameters:
+ *   - ChannelNumber: Logical PWM channel.
+ *   - Period: Period in timer ticks (TOP for fast PWM is Period - 1).
+ *   - DutyCycle: 0x0000 (0 %) .. 0x8000 (100 %).
+ * Outputs:
+ *   - None
+ *   - Only channels on Timer1 have a variable period (ICR1); the period is shared by
+ *     OC1A and OC1B and the duty cycle of the other channel is kept.
+ *   - On Timer0/Timer2 the period is ignored and only the duty cycle is set.
+ * Conformance to AUTOSAR Standard: 
+ *   - Follows the AUTOSAR Pwm_SetPeriodAndDuty API.
+ * Reentrancy: 
+ *   - Non-Reentrant
+ **************************************************************/
+extern void Pwm_SetPeriodAndDuty(Pwm_ChannelType ChannelNumber, Pwm_PeriodType Period, uint16_t DutyCycle);
+
+/**************************************************************
+ * Description: Sets the output of a channel to its configured idle state.
+ * Parameters:
+ *   - ChannelNumber: Logical PWM channel.
+ * Outputs:
+ *   - None
+ *   - The pin is disconnected from the timer at the next overflow.
+ * Conformance to AUTOSAR Standard: 
+ *   - Follows the AUTOSAR Pwm_SetOutputToIdle API, the next Pwm_SetDutyCycle resumes the output.
+ * Reentrancy: 
+ *   - Reentrant for different channels.
+ **************************************************************/
+extern void Pwm_SetOutputToIdle(Pwm_ChannelType ChannelNumber);
+
+/**************************************************************
+ * Description: Enables the edge notification of a channel.
+ * Parameters:
+ *   - ChannelNumber: Logical PWM channel.
+ *   - Notification: PWM_RISING_EDGE, PWM_FALLING_EDGE or PWM_BOTH_EDGES.
+ * Outputs:
+ *   - None
+ *   - The configured callback is called from the timer ISR on the selected edges.
+ * Conformance to AUTOSAR Standard: 
+ *   - Follows the AUTOSAR Pwm_EnableNotification API.
+ * Reentrancy: 
+ *   - Reentrant for different channels.
+ **************************************************************/
+extern void Pwm_EnableNotification(Pwm_ChannelType ChannelNumber, Pwm_EdgeNotificationType Notification);
+
+/**************************************************************
+ * Description: Disables the edge notification of a channel.
+ * Parameters:
+ *   - ChannelNumber: Logical PWM channel.
+ * Outputs:
+ *   - None
+ * Conformance to AUTOSAR Standard: 
+ *   - Follows the AUTOSAR Pwm_DisableNotification API.
+ * Reentrancy: 
+ *   - Reentrant for different channels.
+ **************************************************************/
+extern void Pwm_DisableNotification(Pwm_ChannelType ChannelNumber);
+
+/**************************************************************
+ * Description: Returns the output frequency of a timer.
+ * Parameters:
+ *   - Timer: Timer identifier.
+ * Outputs:
+ *   - uint32_t: Frequency in Hz, computed from F_CPU, the prescaler, the mode and TOP.
+ * Reentrancy: 
+ *   - Reentrant
+ **************************************************************/
+extern uint32_t Pwm_GetFrequency(Pwm_TimerType Timer);
+
+/**************************************************************
+ * Description: Sets the duty cycle of a running hardware channel with a single OCRx store.
+ * Parameters:
+ *   - HwChannel: Hardware channel, must be a compile-time constant.
+ *   - DutyCycle: 0x0000 (0 %) .. 0x8000 (100 %), not clamped.
+ * Outputs:
+ *   - None
+ *   - OCRx is double-buffered in PWM mode, the value is latched by the hardware at TOP/BOTTOM.
+ * Reentrancy: 
+ *   - Reentrant for different channels.
+ * Note:
+ *   - With a constant HwChannel the switch folds away; on 8 bit timers the scaling is
+ *     D * 255 / 0x8000 done with a subtract and a shift, on Timer1 it uses the current ICR1.
+ *   - The pin is not reconnected: do not use after Pwm_SetOutputToIdle or a 0 % request,
+ *     and do not mix with Pwm_SetDutyCycle on the same channel. In fast PWM mode 0x0000
+ *     leaves a one tick pulse.
+ **************************************************************/
+static inline void Pwm_SetDutyCycleFast(Pwm_HwChannelType HwChannel, uint16_t DutyCycle)
+{
+    switch (HwChannel)
+    {
+        case PWM_OC0:
+            OCR0 = (uint8_t)((DutyCycle - (DutyCycle >> 8)) >> 7);
+            break;
+        case PWM_OC1A:
+            OCR1A = (uint16_t)(((uint32_t)DutyCycle * ICR1) >> 15);
+            break;
+        case PWM_OC1B:
+            OCR1B = (uint16_t)(((uint32_t)DutyCycle * ICR1) >> 15);
+            break;
+        case PWM_OC2:
+            OCR2 = (uint8_t)((DutyCycle - (DutyCycle >> 8)) >> 7);
+            break;
+    }
+}
+
+
+#endif /* PWM_H_ */
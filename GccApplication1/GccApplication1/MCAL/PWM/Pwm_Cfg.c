@@ -0,0 +1,36 @@
+/*
+ * Pwm_Cfg.c
+ *
+ * Created: 19 October 2026
+ * Author: Diaa Ahmed
+ * Description: AUTOSAR-compliant configuration source file for the PWM module.
+ * 
+ * This file contains the mode, clock prescaler and TOP value of every timer used
+ * by the PWM module, and the table of logical PWM channels mapped onto the output
+ * compare pins of Timer0/1/2. The output frequency shown on the display is derived
+ * from these values.
+ * 
+ * Note: This file is part of the AUTOSAR-compliant implementation and should not be modified
+ * without careful consideration of the impact on the entire system.
+ */
+
+
+#include "Pwm_Cfg.h"
+
+/* Actual configuration data for PWM timers */
+const Pwm_TimerConfigType Pwm_TimerConfig[PWM_MAX_TIMERS] = {
+	{PWM_MODE_FAST,          8u,  0x00FFu},  // TIMER0: 3.9 kHz at 8 MHz
+	{PWM_MODE_PHASE_CORRECT, 1u,  0x00FFu},  // TIMER1: TOP in ICR1
+	{PWM_MODE_FAST,          1u,  0x00FFu}   // TIMER2: 31.25 kHz at 8 MHz
+};
+
+/* Actual configuration data for logical PWM channels */
+const Pwm_ChannelConfigType Pwm_ChannelConfig[PWM_NUM_CHANNELS] = {
+	{PWM_OC2, PWM_HIGH, PWM_LOW, 0x0000u, 0}   // PwmConf_PwmChannel_Signal
+};
+
+const Pwm_ConfigType Pwm_Config = {
+	Pwm_TimerConfig,
+	Pwm_ChannelConfig,
+	PWM_NUM_CHANNELS
+};
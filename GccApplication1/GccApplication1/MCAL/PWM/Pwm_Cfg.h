@@ -0,0 +1,49 @@
+/*
+ * Pwm_Cfg.h
+ *
+ * Created: 19 October 2026
+ * Author: Diaa Ahmed
+ * Description: AUTOSAR-compliant configuration header file for the PWM module.
+ * 
+ * This file selects which hardware PWM channels are used, gives the logical channels
+ * symbolic names and declares the configuration data defined in Pwm_Cfg.c. The
+ * PWM_OCx_USED switches must match the hardware channels of Pwm_ChannelConfig, they
+ * decide which timer interrupt handlers are compiled into the PWM module.
+ * 
+ * On the reference board OC0 (PB3) is wired to GLCD CS1 and OC1A/OC1B (PD5/PD4) are
+ * GLCD data lines, so only OC2 (PD7) is enabled by default.
+ * 
+ * Note: This file is part of the AUTOSAR-compliant implementation and should not be modified
+ * without careful consideration of the impact on the entire system.
+ */
+
+#ifndef PWM_CFG_H_
+#define PWM_CFG_H_
+
+#include "Pwm_Types.h"  // Include types header
+
+/* Number of timers driving PWM channels */
+#define PWM_MAX_TIMERS      (3u)
+
+/* Number of configured logical channels */
+#define PWM_NUM_CHANNELS    (1u)
+
+/* Symbolic names of the logical channels */
+#define PwmConf_PwmChannel_Signal   (0u)   /* Signal shown on the GLCD, OC2 */
+
+/* Hardware channel usage (1u = used, 0u = unused) */
+#define PWM_OC0_USED        (0u)
+#define PWM_OC1A_USED       (0u)
+#define PWM_OC1B_USED       (0u)
+#define PWM_OC2_USED        (1u)
+
+#define PWM_TIMER0_USED     (PWM_OC0_USED)
+#define PWM_TIMER1_USED     (PWM_OC1A_USED | PWM_OC1B_USED)
+#define PWM_TIMER2_USED     (PWM_OC2_USED)
+
+/* PWM timer and channel configurations */
+extern const Pwm_TimerConfigType Pwm_TimerConfig[PWM_MAX_TIMERS];
+extern const Pwm_ChannelConfigType Pwm_ChannelConfig[PWM_NUM_CHANNELS];
+extern const Pwm_ConfigType Pwm_Config;
+
+#endif /* PWM_CFG_H_ */
@@ -0,0 +1,90 @@
+/*
+ * Pwm_Types.h
+ *
+ * Created: 19 October 2026
+ * Author: Diaa Ahmed
+ * Description: AUTOSAR-compliant types header file for the PWM module.
+ * 
+ * This file includes type definitions specific to the PWM module, such as the hardware
+ * output channels, the timer identifiers, the waveform generation modes, the output
+ * states and edge notifications, and the configuration structures used by the
+ * configuration source file.
+ * 
+ * Note: This file is part of the AUTOSAR-compliant implementation and should not be modified
+ * without careful consideration of the impact on the entire system.
+ */
+
+
+#ifndef PWM_TYPES_H_
+#define PWM_TYPES_H_
+
+#include <stdint.h>  // Include standard integer types
+
+/* Enumeration for the hardware PWM output channels of the ATmega32 */
+typedef enum {
+	PWM_OC0,      /* Timer0 output compare pin (PB3) */
+	PWM_OC1A,     /* Timer1 output compare A pin (PD5) */
+	PWM_OC1B,     /* Timer1 output compare B pin (PD4) */
+	PWM_OC2       /* Timer2 output compare pin (PD7) */
+} Pwm_HwChannelType;
+
+/* Enumeration for the timers driving the PWM channels */
+typedef enum {
+	PWM_TIMER0,
+	PWM_TIMER1,
+	PWM_TIMER2
+} Pwm_TimerType;
+
+/* Enumeration for the waveform generation mode */
+typedef enum {
+	PWM_MODE_FAST,            /* Single slope, f = F_CPU / (N * (TOP + 1)) */
+	PWM_MODE_PHASE_CORRECT    /* Dual slope,   f = F_CPU / (2 * N * TOP), phase and frequency correct on Timer1 */
+} Pwm_ModeType;
+
+/* Enumeration for the output state (polarity and idle level) */
+typedef enum {
+	PWM_LOW,      /* Low level */
+	PWM_HIGH      /* High level */
+} Pwm_OutputStateType;
+
+/* Enumeration for the edges reported by the channel notification */
+typedef enum {
+	PWM_RISING_EDGE  = 1,
+	PWM_FALLING_EDGE = 2,
+	PWM_BOTH_EDGES   = 3
+} Pwm_EdgeNotificationType;
+
+/* Type definition for the logical PWM channel (index into the channel configuration) */
+typedef uint8_t Pwm_ChannelType;
+
+/* Type definition for the PWM period in timer ticks */
+typedef uint16_t Pwm_PeriodType;
+
+/* Type definition for the channel notification callback */
+typedef void (*Pwm_NotificationType)(void);
+
+/* Type definition for PWM timer configuration */
+typedef struct {
+	Pwm_ModeType Mode;    /* Waveform generation mode */
+	uint16_t Prescaler;   /* Clock divider (1, 8, 64, 256, 1024; Timer2 also 32, 128) */
+	uint16_t Top;         /* Counter TOP, only configurable on Timer1 (ICR1), 0xFF otherwise */
+} Pwm_TimerConfigType;
+
+/* Type definition for PWM channel configuration */
+typedef struct {
+	Pwm_HwChannelType HwChannel;        /* Output compare pin driven by the channel */
+	Pwm_OutputStateType Polarity;       /* Level during the duty part of the period */
+	Pwm_OutputStateType IdleState;      /* Level after Pwm_SetOutputToIdle */
+	uint16_t DutyCycle;                 /* Initial duty cycle, 0x0000..0x8000 */
+	Pwm_NotificationType Notification;  /* Edge notification callback, 0 if unused */
+} Pwm_ChannelConfigType;
+
+/* Type definition for the PWM module configuration */
+typedef struct {
+	const Pwm_TimerConfigType* Timers;       /* One entry per timer */
+	const Pwm_ChannelConfigType* Channels;   /* One entry per logical channel */
+	uint8_t NumChannels;                     /* Number of logical channels */
+} Pwm_ConfigType;
+
+
+#endif /* PWM_TYPES_H_ */
@@ -0,0 +1,255 @@
+/*
+ * SoftPwm.c
+ *
+ * Created: 19 October 2026
+ * Author: Diaa Ahmed
+ * Description: Implementation file for the software PWM module.
+ * 
+ * This file contains the implementation of the sorted-edge software PWM. The Timer1
+ * compare A interrupt alternates between the period start, where all channels with a
+ * non-zero duty are switched on, and the falling edges of the schedule. Channels with
+ * the same duty share one schedule entry, so the interrupt fires once per distinct duty.
+ * SoftPwm_SetDuty sorts the duties into the shadow of two schedules and marks it ready,
+ * the interrupt only switches to it at the next period start. OCR1A is advanced relative to the period start, and events that are already due when
+ * the next compare value is set are handled in the same interrupt.
+ * 
+ * Note: This file is part of the AUTOSAR-compliant implementation and should not be
+ * modified without careful consideration of the impact on the entire system.
+ */
+
+#include <stdint-gcc.h>
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include "../DIO/Dio.h"
+#include "../DIO/DIO_Cfg.h"
+#include "../PWM/Pwm_Cfg.h"
+#include "SoftPwm_Cfg.h"
+#include "SoftPwm.h"
+
+#if SOFTPWM_USED
+
+#if PWM_TIMER1_USED
+#error "SoftPwm needs Timer1 in normal mode, disable the Timer1 PWM channels"
+#endif
+
+#if (SOFTPWM_NUM_CHANNELS < 1u) || (SOFTPWM_NUM_CHANNELS > 16u)
+#error "SOFTPWM_NUM_CHANNELS must be 1..16"
+#endif
+
+/* Number of ports */
+#define SOFTPWM_NUM_PORTS       (4u)
+
+/* Timer1 ticks per period */
+#define SOFTPWM_PERIOD_TICKS    ((uint16_t)(SOFTPWM_DUTY_FULL * SOFTPWM_TICKS_PER_STEP))
+
+/* Type definition for one falling edge of the schedule */
+typedef struct {
+	uint8_t Duty;                           /* Edge time in duty steps */
+	uint8_t ClearMask[SOFTPWM_NUM_PORTS];   /* Pins switched off at this edge */
+} SoftPwm_EdgeType;
+
+/* Type definition for the schedule of one period */
+typedef struct {
+	SoftPwm_EdgeType Edge[SOFTPWM_NUM_CHANNELS];
+	uint8_t EdgeCount;
+	uint8_t OnMask[SOFTPWM_NUM_PORTS];      /* Pins switched on at the period start */
+} SoftPwm_ScheduleType;
+
+static volatile uint8_t* const SoftPwm_Port[SOFTPWM_NUM_PORTS] = {
+	&PORTA, &PORTB, &PORTC, &PORTD
+};
+
+static uint8_t SoftPwm_Duty[SOFTPWM_NUM_CHANNELS];
+
+/* Active schedule of the ISR and its shadow; the ISR switches to the shadow at the next
+ * period start once SoftPwm_Ready is set, SoftPwm_SetDuty clears it while it builds */
+static SoftPwm_ScheduleType SoftPwm_Schedule[2];
+static volatile uint8_t SoftPwm_Active;
+static volatile uint8_t SoftPwm_Ready;
+
+/* Only accessed by the ISR after initialization */
+static uint8_t SoftPwm_NextEdge;
+static uint8_t SoftPwm_AllMask[SOFTPWM_NUM_PORTS];
+static uint16_t SoftPwm_PeriodStart;
+
+/* Sorts the channel duties into a schedule (insertion sort, at most 16 entries) */
+static void SoftPwm_Build(SoftPwm_ScheduleType* Sched)
+{
+    uint8_t Channel, Port, Mask, Duty, i, j, Count = 0u;
+    SoftPwm_EdgeType* Edge = Sched->Edge;
+
+    for (Port = 0u; Port < SOFTPWM_NUM_PORTS; Port++)
+    {
+        Sched->OnMask[Port] = 0u;
+    }
+
+    for (Channel = 0u; Channel < SOFTPWM_NUM_CHANNELS; Channel++)
+    {
+        Duty = SoftPwm_Duty[Channel];
+        Port = Dio_ChannelConfig[SoftPwm_ChannelConfig[Channel] - 1u].Port;
+        Mask = (uint8_t)(1u << Dio_ChannelConfig[SoftPwm_ChannelConfig[Channel] - 1u].Pin);
+
+        if (Duty == 0u)
+        {
+            continue;
+        }
+        Sched->OnMask[Port] |= Mask;
+        if (Duty == SOFTPWM_DUTY_FULL)
+        {
+            continue;
+        }
+
+        for (i = 0u; (i < Count) && (Edge[i].Duty < Duty); i++)
+        {
+        }
+        if ((i < Count) && (Edge[i].Duty == Duty))
+        {
+            Edge[i].ClearMask[Port] |= Mask;
+            continue;
+        }
+        for (j = Count; j > i; j--)
+        {
+            Edge[j] = Edge[j - 1u];
+        }
+        Edge[i].Duty = Duty;
+        for (j = 0u; j < SOFTPWM_NUM_PORTS; j++)
+        {
+            Edge[i].ClearMask[j] = 0u;
+        }
+        Edge[i].ClearMask[Port] = Mask;
+        Count++;
+    }
+    Sched->EdgeCount = Count;
+}
+
+/**************************************************************
+ * Description: Initializes the software PWM channels and starts Timer1.
+ * Parameters:
+ *   - None
+ * Outputs:
+ *   - None
+ *   - Configures the channels of SoftPwm_ChannelConfig as outputs, all at 0 % duty.
+ *   - Starts Timer1 in normal mode and enables the compare A interrupt.
+ * Reentrancy: 
+ *   - Non-Reentrant
+ * Note:
+ *   - Global interrupts must be enabled for the outputs to run.
+ **************************************************************/
+void SoftPwm_Init(void)
+{
+    uint8_t Channel, Port;
+    const Dio_ChannelConfigType* Cfg;
+
+    for (Port = 0u; Port < SOFTPWM_NUM_PORTS; Port++)
+    {
+        SoftPwm_AllMask[Port] = 0u;
+    }
+    for (Channel = 0u; Channel < SOFTPWM_NUM_CHANNELS; Channel++)
+    {
+        SoftPwm_Duty[Channel] = 0u;
+        Cfg = &Dio_ChannelConfig[SoftPwm_ChannelConfig[Channel] - 1u];
+        SoftPwm_AllMask[Cfg->Port] |= (uint8_t)(1u << Cfg->Pin);
+        Dio_WriteChannel(SoftPwm_ChannelConfig[Channel], DIO_LOW);
+        Dio_InitChannel(SoftPwm_ChannelConfig[Channel], DIO_OUTPUT);
+    }
+    SoftPwm_Active = 0u;
+    SoftPwm_Ready = 0u;
+    SoftPwm_Build(&SoftPwm_Schedule[0]);
+    SoftPwm_NextEdge = SoftPwm_Schedule[0].EdgeCount;
+
+    /* Normal mode, the first period starts one step from now */
+    TCCR1A &= ~((1u << WGM11) | (1u << WGM10));
+    TCCR1B = (TCCR1B & ~((1u << WGM13) | (1u << WGM12) | 0x07u)) | SOFTPWM_TIMER1_CS;
+    OCR1A = TCNT1 + SOFTPWM_TICKS_PER_STEP;
+    TIFR = (1u << OCF1A);
+    TIMSK |= (1u << OCIE1A);
+}
+
+/**************************************************************
+ * Description: Sets the duty cycle of a software PWM channel.
+ * Parameters:
+ *   - Channel: Index into SoftPwm_ChannelConfig.
+ *   - Duty: 0 (always low) .. SOFTPWM_DUTY_FULL (always high).
+ * Outputs:
+ *   - None
+ *   - The shadow schedule is rebuilt here and used from the start of the next period.
+ * Reentrancy: 
+ *   - Non-Reentrant, call from the main context only.
+ **************************************************************/
+void SoftPwm_SetDuty(uint8_t Channel, uint8_t Duty)
+{
+    if (Channel >= SOFTPWM_NUM_CHANNELS)
+    {
+        /* Error: Invalid channel */
+        return;
+    }
+    SoftPwm_Duty[Channel] = Duty;
+
+    /* The ISR keeps its schedule while the shadow is rebuilt, a period start in between
+     * only delays the switch by one period */
+    SoftPwm_Ready = 0u;
+    SoftPwm_Build(&SoftPwm_Schedule[SoftPwm_Active ^ 1u]);
+    SoftPwm_Ready = 1u;
+}
+
+ISR(TIMER1_COMPA_vect)
+{
+    uint8_t Port, Mask, Due;
+    uint16_t Next;
+    const SoftPwm_ScheduleType* Sched = &SoftPwm_Schedule[SoftPwm_Active];
+
+    do
+    {
+        if (SoftPwm_NextEdge >= Sched->EdgeCount)
+        {
+            /* Period start: switch to a ready shadow, then one write per port switches all channels */
+            SoftPwm_PeriodStart = OCR1A;
+            if (SoftPwm_Ready)
+            {
+                SoftPwm_Ready = 0u;
+                SoftPwm_Active ^= 1u;
+                Sched = &SoftPwm_Schedule[SoftPwm_Active];
+            }
+            for (Port = 0u; Port < SOFTPWM_NUM_PORTS; Port++)
+            {
+                if (SoftPwm_AllMask[Port])
+                {
+                    *SoftPwm_Port[Port] = (*SoftPwm_Port[Port] & ~SoftPwm_AllMask[Port]) | Sched->OnMask[Port];
+                }
+            }
+            SoftPwm_NextEdge = 0u;
+        }
+        else
+        {
+            /* Falling edge of every channel with this duty */
+            for (Port = 0u; Port < SOFTPWM_NUM_PORTS; Port++)
+            {
+                Mask = Sched->Edge[SoftPwm_NextEdge].ClearMask[Port];
+                if (Mask)
+                {
+                    *SoftPwm_Port[Port] &= ~Mask;
+                }
+            }
+            SoftPwm_NextEdge++;
+        }
+
+        if (SoftPwm_NextEdge < Sched->EdgeCount)
+        {
+            Next = SoftPwm_PeriodStart + (uint16_t)Sched->Edge[SoftPwm_NextEdge].Duty * SOFTPWM_TICKS_PER_STEP;
+        }
+        else
+        {
+            Next = SoftPwm_PeriodStart + SOFTPWM_PERIOD_TICKS;
+        }
+        OCR1A = Next;
+
+        /* Handle an event that is already due here, a missed match would wait for a full wrap */
+        Due = ((int16_t)(TCNT1 - Next) >= 0);
+        if (Due)
+        {
+            TIFR = (1u << OCF1A);
+        }
+    } while (Due);
+}
+
+#endif /* SOFTPWM_USED */
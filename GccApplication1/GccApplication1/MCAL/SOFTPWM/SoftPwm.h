@@ -0,0 +1,61 @@
+/*
+ * SoftPwm.h
+ *
+ * Created: 19 October 2026
+ * Author: Diaa Ahmed
+ * Description: AUTOSAR-compliant header file for the software PWM module.
+ * 
+ * This file contains the declarations and prototypes for the software PWM module, which
+ * generates slow PWM signals on any DIO channel. A duty change sorts the channel duties
+ * into an edge schedule, which takes effect at the next period start; Timer1 then interrupts once per distinct duty
+ * value and every edge is applied with one masked write per port. The interrupt load
+ * scales with the number of distinct duties instead of the duty resolution.
+ * 
+ * Timer1 runs free in normal mode and only its compare A unit is used, the input capture
+ * unit stays available. The module cannot be combined with hardware PWM on Timer1 and is
+ * only compiled when SOFTPWM_USED is set.
+ * 
+ * Note: This file is part of the AUTOSAR-compliant implementation and should not be modified
+ * without careful consideration of the impact on the entire system.
+ */ 
+
+#ifndef SOFTPWM_H_
+#define SOFTPWM_H_
+
+#include <stdint.h>
+
+/* Full scale duty cycle (100 %), one period is this many steps */
+#define SOFTPWM_DUTY_FULL       (255u)
+
+/* Function prototypes */
+
+/**************************************************************
+ * Description: Initializes the software PWM channels and starts Timer1.
+ * Parameters:
+ *   - None
+ * Outputs:
+ *   - None
+ *   - Configures the channels of SoftPwm_ChannelConfig as outputs, all at 0 % duty.
+ *   - Starts Timer1 in normal mode and enables the compare A interrupt.
+ * Reentrancy: 
+ *   - Non-Reentrant
+ * Note:
+ *   - Global interrupts must be enabled for the outputs to run.
+ **************************************************************/
+extern void SoftPwm_Init(void);
+
+/**************************************************************
+ * Description: Sets the duty cycle of a software PWM channel.
+ * Parameters:
+ *   - Channel: Index into SoftPwm_ChannelConfig.
+ *   - Duty: 0 (always low) .. SOFTPWM_DUTY_FULL (always high).
+ * Outputs:
+ *   - None
+ *   - The shadow schedule is rebuilt here and used from the start of the next period.
+ * Reentrancy: 
+ *   - Non-Reentrant, call from the main context only.
+ **************************************************************/
+extern void SoftPwm_SetDuty(uint8_t Channel, uint8_t Duty);
+
+
+#endif /* SOFTPWM_H_ */
@@ -0,0 +1,29 @@
+/*
+ * SoftPwm_Cfg.c
+ *
+ * Created: 19 October 2026
+ * Author: Diaa Ahmed
+ * Description: AUTOSAR-compliant configuration source file for the software PWM module.
+ * 
+ * This file maps the software PWM channels onto DIO channels (see Dio_ChannelConfig).
+ * 
+ * Note: This file is part of the AUTOSAR-compliant implementation and should not be modified
+ * without careful consideration of the impact on the entire system.
+ */
+
+
+#include "SoftPwm_Cfg.h"
+
+#if SOFTPWM_USED
+
+/* Actual configuration data for software PWM channels */
+const uint8_t SoftPwm_ChannelConfig[SOFTPWM_NUM_CHANNELS] = {
+	3u,   // PORTA PIN 2
+	4u,   // PORTA PIN 3
+	5u,   // PORTA PIN 4
+	6u,   // PORTA PIN 5
+	7u,   // PORTA PIN 6
+	8u    // PORTA PIN 7
+};
+
+#endif /* SOFTPWM_USED */
@@ -0,0 +1,39 @@
+/*
+ * SoftPwm_Cfg.h
+ *
+ * Created: 19 October 2026
+ * Author: Diaa Ahmed
+ * Description: AUTOSAR-compliant configuration header file for the software PWM module.
+ * 
+ * This file contains the number of software PWM channels, the Timer1 clock and the length
+ * of one duty step. One period is 255 steps, so with F_CPU = 8 MHz, a Timer1 clock of
+ * F_CPU / 8 and 39 ticks per step the period is 9945 us (about 100 Hz).
+ * 
+ * The channels should not share a port with pins written from the main loop through
+ * read-modify-write (the GLCD bus uses PORTB/PORTC/PORTD), the default uses PA2..PA7.
+ * 
+ * Note: This file is part of the AUTOSAR-compliant implementation and should not be modified
+ * without careful consideration of the impact on the entire system.
+ */
+
+#ifndef SOFTPWM_CFG_H_
+#define SOFTPWM_CFG_H_
+
+#include <stdint.h>
+
+/* Software PWM built in, it takes Timer1 and its compare A vector (1u = used, 0u = unused) */
+#define SOFTPWM_USED            (0u)
+
+/* Number of software PWM channels (1..16) */
+#define SOFTPWM_NUM_CHANNELS    (6u)
+
+/* Timer1 clock select bits CS12:0, 2 = F_CPU / 8 */
+#define SOFTPWM_TIMER1_CS       (2u)
+
+/* Timer1 ticks per duty step, at least the worst case ISR latency */
+#define SOFTPWM_TICKS_PER_STEP  (39u)
+
+/* DIO channel of every software PWM channel */
+extern const uint8_t SoftPwm_ChannelConfig[SOFTPWM_NUM_CHANNELS];
+
+#endif /* SOFTPWM_CFG_H_ */
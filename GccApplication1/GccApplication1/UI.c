@@ -0,0 +1,306 @@
+/*
+ * UI.c
+ *
+ * Created: 19-Oct-26
+ *  Author: diaag
+ */ 
+
+#include <stdint.h>
+#include <avr/pgmspace.h>
+
+#include "GLCD.h"
+#include "GLCD_Font.h"
+#include "GLCD_Plot.h"
+#include "UI.h"
+#include "UI_cfg.h"
+
+/* Tick column bytes of a bar: top row on its first page, bottom row on its last */
+#define UI_TICK_TOP		(0x01u)
+#define UI_TICK_BOTTOM	(0x80u)
+
+static UI_WidgetStateType UI_State[UI_NUM_WIDGETS];
+
+/* Marks columns x0..x1 of the box of widget id, clipped to the box */
+static void UI_Mark(uint8_t id, uint8_t x0, uint8_t x1)
+{
+	UI_WidgetStateType* st = &UI_State[id];
+	uint8_t last = UI_WidgetConfig[id].Width - 1;
+
+	if (x0 > last) {
+		return;
+	}
+	if (x1 > last) {
+		x1 = last;
+	}
+	if (st->DirtyMin > st->DirtyMax) {
+		st->DirtyMin = x0;
+		st->DirtyMax = x1;
+		return;
+	}
+	if (x0 < st->DirtyMin) st->DirtyMin = x0;
+	if (x1 > st->DirtyMax) st->DirtyMax = x1;
+}
+
+/* Page p of a text into the box columns out[0..Width-1] */
+static void UI_RenderText(const UI_WidgetConfigType* cfg, const char* s, uint8_t flash, uint8_t p, uint8_t* out)
+{
+	uint8_t cell = (uint8_t)cfg->Param;
+	uint8_t total = 0, x = 0, i, n = 0;
+
+	for (i = 0; i < cfg->Width; i++) {
+		out[i] = 0x00;
+	}
+	if (p >= GLCD_Font_Pages(cfg->Font)) {
+		return;
+	}
+
+	if (cfg->Align != UI_ALIGN_LEFT)
+	{
+		if (cell != 0) {
+			while ((flash ? pgm_read_byte(&s[n]) : s[n]) != '\0') n++;
+			total = (uint8_t)(n * cell);
+		} else {
+			total = flash ? GLCD_Font_StringWidth_P(cfg->Font, s) : GLCD_Font_StringWidth(cfg->Font, s);
+		}
+		if (total < cfg->Width) {
+			x = cfg->Width - total;
+			if (cfg->Align == UI_ALIGN_CENTER) {
+				x /= 2;
+			}
+		}
+	}
+
+	/* Only page p of each glyph is decoded */
+	if (flash) {
+		GLCD_Font_RenderPage_P(cfg->Font, s, p, cell, &out[x], cfg->Width - x);
+	} else {
+		GLCD_Font_RenderPage(cfg->Font, s, p, cell, &out[x], cfg->Width - x);
+	}
+}
+
+/* Filled columns of a bar or meter for value, a meter snaps down to whole segments */
+static uint8_t UI_Fill(const UI_WidgetConfigType* cfg, uint16_t value)
+{
+	uint8_t fill;
+
+	if (cfg->Param == 0) {
+		return 0;
+	}
+	if (value > cfg->Param) {
+		value = cfg->Param;
+	}
+	fill = (uint8_t)((uint32_t)value * cfg->Width / cfg->Param);
+	if (cfg->Type == UI_METER && cfg->Param2 != 0) {
+		fill -= fill % (uint8_t)cfg->Param2;
+	}
+	return fill;
+}
+
+/* Page p of widget id into the box columns out[0..Width-1] */
+static void UI_Render(uint8_t id, uint8_t p, uint8_t* out)
+{
+	const UI_WidgetConfigType* cfg = &UI_WidgetConfig[id];
+	const UI_WidgetStateType* st = &UI_State[id];
+	uint8_t i, fill, tick, k, next, seg;
+
+	switch (cfg->Type)
+	{
+	case UI_LABEL:
+		UI_RenderText(cfg, (const char*)cfg->Source, 1, p, out);
+		break;
+	case UI_TEXT:
+		UI_RenderText(cfg, (const char*)cfg->Buffer, 0, p, out);
+		break;
+	case UI_BAR:
+		fill = UI_Fill(cfg, st->Value);
+		tick = (uint8_t)(((p == 0) ? UI_TICK_TOP : 0u) | ((p == cfg->Pages - 1) ? UI_TICK_BOTTOM : 0u));
+		k = 0;
+		next = 0;
+		for (i = 0; i < cfg->Width; i++)
+		{
+			out[i] = (i < fill) ? 0xFF : 0x00;
+			if (cfg->Param2 != 0 && i == next) {
+				/* Tick k of Param2 divisions, the last one on the last column */
+				out[i] ^= tick;
+				k++;
+				next = (uint8_t)((uint16_t)k * (cfg->Width - 1) / cfg->Param2);
+			}
+		}
+		break;
+	case UI_METER:
+		fill = UI_Fill(cfg, st->Value);
+		seg = 0;
+		for (i = 0; i < cfg->Width; i++)
+		{
+			/* Last column of every segment is the gap */
+			out[i] = (i < fill && seg + 1u != cfg->Param2) ? 0xFF : 0x00;
+			if (++seg >= cfg->Param2) {
+				seg = 0;
+			}
+		}
+		break;
+	case UI_PLOT:
+		GLCD_Plot_RenderSquare((const GLCD_PlotType*)cfg->Buffer, p, out, cfg->Width, (uint8_t)st->Value, (uint8_t)st->Value2);
+		break;
+	default:	/* UI_ICON */
+		for (i = 0; i < cfg->Width; i++) {
+			out[i] = pgm_read_byte(&((const uint8_t*)cfg->Source)[(uint16_t)p * cfg->Width + i]);
+		}
+		break;
+	}
+}
+
+void UI_Init(void)
+{
+	const UI_WidgetConfigType* cfg;
+	uint8_t id, i;
+
+	for (id = 0; id < UI_NUM_WIDGETS; id++)
+	{
+		cfg = &UI_WidgetConfig[id];
+		UI_State[id].Value = 0;
+		UI_State[id].Value2 = 0;
+		if (cfg->Type == UI_TEXT) {
+			for (i = 0; i < cfg->Param2; i++) {
+				((char*)cfg->Buffer)[i] = '\0';
+			}
+		} else if (cfg->Type == UI_PLOT) {
+			GLCD_Plot_Init((GLCD_PlotType*)cfg->Buffer, cfg->Page, cfg->Pages, (uint8_t)cfg->Param, (uint8_t)cfg->Param2);
+			UI_State[id].Value = 1;
+		}
+		UI_State[id].DirtyMin = 0xFF;
+		UI_State[id].DirtyMax = 0x00;
+		UI_Invalidate(id);
+	}
+}
+
+void UI_Invalidate(uint8_t id)
+{
+	UI_Mark(id, 0, 0xFF);
+}
+
+void UI_InvalidateSpan(uint8_t id, uint8_t x0, uint8_t x1)
+{
+	if (x0 <= x1) {
+		UI_Mark(id, x0, x1);
+	}
+}
+
+void UI_SetText(uint8_t id, const char* text)
+{
+	const UI_WidgetConfigType* cfg = &UI_WidgetConfig[id];
+	char* shown = (char*)cfg->Buffer;
+	uint8_t cell = (uint8_t)cfg->Param;
+	uint8_t i, ended = 0, first = 0xFF, last = 0;
+	char c;
+
+	/* The shown copy is NUL padded to its end, so a position compares equal only if it looks the same */
+	for (i = 0; i + 1u < cfg->Param2; i++)
+	{
+		c = ended ? '\0' : text[i];
+		if (c == '\0') {
+			ended = 1;
+		}
+		if (shown[i] != c) {
+			if (first == 0xFF) first = i;
+			last = i;
+			shown[i] = c;
+		}
+	}
+
+	if (first == 0xFF) {
+		return;
+	}
+	if (cell != 0 && cfg->Align == UI_ALIGN_LEFT) {
+		UI_Mark(id, (uint8_t)(first * cell), (uint8_t)((last + 1u) * cell - 1u));
+	} else {
+		UI_Invalidate(id);
+	}
+}
+
+void UI_SetValue(uint8_t id, uint16_t value)
+{
+	const UI_WidgetConfigType* cfg = &UI_WidgetConfig[id];
+	uint8_t from, to;
+
+	if (UI_State[id].Value == value) {
+		return;
+	}
+	if (cfg->Type == UI_BAR || cfg->Type == UI_METER)
+	{
+		/* Only the columns between the old and the new fill position change */
+		from = UI_Fill(cfg, UI_State[id].Value);
+		to = UI_Fill(cfg, value);
+		if (from != to) {
+			UI_Mark(id, (from < to) ? from : to, ((from > to) ? from : to) - 1u);
+		}
+	}
+	else
+	{
+		UI_Invalidate(id);
+	}
+	UI_State[id].Value = value;
+}
+
+void UI_SetPlot(uint8_t id, uint8_t period, uint8_t highCols)
+{
+	if (period == 0) {
+		period = 1;
+	}
+	if (UI_State[id].Value != period || UI_State[id].Value2 != highCols) {
+		UI_State[id].Value = period;
+		UI_State[id].Value2 = highCols;
+		UI_Invalidate(id);
+	}
+}
+
+void UI_Update(void)
+{
+	uint8_t row[128];
+	uint8_t spanX0[UI_NUM_WIDGETS], spanX1[UI_NUM_WIDGETS];
+	const UI_WidgetConfigType* cfg;
+	const UI_WidgetStateType* st;
+	uint8_t page, id, n, i, j, t0, t1, x0, x1;
+
+	for (page = 0; page < GLCD_PAGES; page++)
+	{
+		/* Render the dirty widgets of this page and collect their spans, sorted by column */
+		n = 0;
+		for (id = 0; id < UI_NUM_WIDGETS; id++)
+		{
+			cfg = &UI_WidgetConfig[id];
+			st = &UI_State[id];
+			if (st->DirtyMin > st->DirtyMax || page < cfg->Page || page >= cfg->Page + cfg->Pages) {
+				continue;
+			}
+			UI_Render(id, page - cfg->Page, &row[cfg->X]);
+			t0 = cfg->X + st->DirtyMin;
+			t1 = cfg->X + st->DirtyMax;
+			for (i = n; i > 0 && spanX0[i - 1] > t0; i--) {
+				spanX0[i] = spanX0[i - 1];
+				spanX1[i] = spanX1[i - 1];
+			}
+			spanX0[i] = t0;
+			spanX1[i] = t1;
+			n++;
+		}
+
+		/* Touching spans go out as one burst */
+		for (i = 0; i < n; i = j)
+		{
+			x0 = spanX0[i];
+			x1 = spanX1[i];
+			for (j = i + 1; j < n && spanX0[j] <= x1 + 1u; j++) {
+				if (spanX1[j] > x1) {
+					x1 = spanX1[j];
+				}
+			}
+			GLCD_WriteRow(page, x0, &row[x0], x1 - x0 + 1);
+		}
+	}
+
+	for (id = 0; id < UI_NUM_WIDGETS; id++) {
+		UI_State[id].DirtyMin = 0xFF;
+		UI_State[id].DirtyMax = 0x00;
+	}
+}
@@ -0,0 +1,87 @@
+/*
+ * UI.h
+ *
+ * Created: 19-Oct-26
+ *  Author: diaag
+ *
+ * Retained-mode screen layer. The screen is a table of widgets in UI_cfg.c,
+ * each a box of whole pages (Page, Pages) by columns (X, Width) with a type
+ * and its data; the RAM behind the widgets (state, text copies, plots) is
+ * static, sized by that table. The application only hands over new values;
+ * a widget whose value changed marks the columns it needs redrawn and
+ * UI_Update renders the dirty columns of every page into one row buffer and
+ * sends touching spans of different widgets as a single GLCD_WriteRow burst.
+ *
+ * Widgets must not overlap. A text widget with a cell width (Param) keeps
+ * every character in a cell of that many columns and redraws only the cells
+ * that changed; without one the whole box is redrawn on a change.
+ *
+ * Bars and meters are whole bytes: 0xFF columns up to the value, 0x00 after,
+ * tick marks are fixed column bytes XORed in. A new value marks only the
+ * columns between the old and the new fill position, so a change of a few
+ * percent sends a few bytes.
+ */ 
+
+
+#ifndef UI_H_
+#define UI_H_
+
+#include <stdint.h>
+#include "GLCD_Font.h"
+
+/* Widget types */
+#define UI_LABEL		(0u)	/* Source: program memory string */
+#define UI_TEXT			(1u)	/* Buffer: char[Param2] shown copy, Param: cell width or 0 */
+#define UI_BAR			(2u)	/* Value of Param (full scale) filled from the left, Param2: tick divisions or 0 */
+#define UI_PLOT			(3u)	/* Buffer: GLCD_PlotType, Param: baseline row, Param2: trace height */
+#define UI_ICON			(4u)	/* Source: page-major bitmap of Width x Pages pages */
+#define UI_METER		(5u)	/* Value of Param in whole segments of Param2 columns (one of them a gap) */
+
+/* Text alignment in the box */
+#define UI_ALIGN_LEFT	(0u)
+#define UI_ALIGN_RIGHT	(1u)
+#define UI_ALIGN_CENTER	(2u)
+
+typedef struct {
+	uint8_t Type;				/* UI_xxx */
+	uint8_t Page;				/* Box: first page */
+	uint8_t Pages;				/* Box: height in pages */
+	uint8_t X;					/* Box: first column */
+	uint8_t Width;				/* Box: columns */
+	uint8_t Align;				/* Text: UI_ALIGN_xxx */
+	const GLCD_FontType* Font;	/* Text: font (program memory) */
+	const void* Source;			/* Program memory data of the type */
+	void* Buffer;				/* RAM data of the type */
+	uint16_t Param;
+	uint16_t Param2;
+} UI_WidgetConfigType;
+
+/* Per widget RAM: dirty columns relative to the box (clean when DirtyMin > DirtyMax) and values */
+typedef struct {
+	uint8_t DirtyMin;
+	uint8_t DirtyMax;
+	uint16_t Value;
+	uint16_t Value2;
+} UI_WidgetStateType;
+
+/* Sets the widgets up and marks them all dirty, the screen is drawn by the next UI_Update */
+extern void UI_Init(void);
+
+/* Marks a whole widget / columns x0..x1 of its box for redraw */
+extern void UI_Invalidate(uint8_t id);
+extern void UI_InvalidateSpan(uint8_t id, uint8_t x0, uint8_t x1);
+
+/* New text of a UI_TEXT widget, only changed characters are marked */
+extern void UI_SetText(uint8_t id, const char* text);
+
+/* New value of a UI_BAR / UI_METER widget */
+extern void UI_SetValue(uint8_t id, uint16_t value);
+
+/* New wave of a UI_PLOT widget: period and high time in columns */
+extern void UI_SetPlot(uint8_t id, uint8_t period, uint8_t highCols);
+
+/* Redraws the dirty columns of all widgets */
+extern void UI_Update(void);
+
+
+#endif /* UI_H_ */
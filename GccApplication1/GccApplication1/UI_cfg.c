@@ -0,0 +1,38 @@
+/*
+ * UI_cfg.c
+ *
+ * Created: 19-Oct-26
+ *  Author: diaag
+ */ 
+
+#include <stdint.h>
+#include <avr/pgmspace.h>
+
+#include "GLCD_Plot.h"
+#include "FONTS/Fonts.h"
+#include "UI.h"
+#include "UI_cfg.h"
+
+static const char UI_PwmLabel[] PROGMEM = "PWM Signal";
+static const char UI_DutyLabel[] PROGMEM = "Duty";
+
+/* Shown copies of the texts and the plot patterns */
+static char UI_DutyText[UI_DUTY_CHARS + 1];
+static char UI_FreqText[UI_LINE_CHARS + 1];
+static GLCD_PlotType UI_Plot;
+#if ICU_USED
+static char UI_MeasText[UI_LINE_CHARS + 1];
+#endif
+
+const UI_WidgetConfigType UI_WidgetConfig[UI_NUM_WIDGETS] = {
+	/* Type      Page Pages  X  Width  Align           Font            Source        Buffer       Param Param2 */
+	{ UI_LABEL,  1,   1,    66,  62,   UI_ALIGN_RIGHT, &Font_Prop5x8,  UI_PwmLabel,  0,           0,    0 },
+	{ UI_LABEL,  2,   1,   102,  26,   UI_ALIGN_RIGHT, &Font_Prop5x8,  UI_DutyLabel, 0,           0,    0 },
+	{ UI_TEXT,   1,   2,     0,  66,   UI_ALIGN_LEFT,  &Font_Digits16, 0,            UI_DutyText, 11,   sizeof(UI_DutyText) },
+	{ UI_TEXT,   3,   1,     0, 128,   UI_ALIGN_LEFT,  &Font_5x8,      0,            UI_FreqText, 5,    sizeof(UI_FreqText) },
+	{ UI_PLOT,   4,   4,     0, 128,   UI_ALIGN_LEFT,  0,              0,            &UI_Plot,    30,   28 },	/* 28 pixel trace */
+	{ UI_BAR,    2,   1,    68,  33,   UI_ALIGN_LEFT,  0,              0,            0,           0x8000u, 4 },	/* Ticks at 0/25/50/75/100 % */
+#if ICU_USED
+	{ UI_TEXT,   0,   1,     0, 128,   UI_ALIGN_LEFT,  &Font_5x8,      0,            UI_MeasText, 5,    sizeof(UI_MeasText) },
+#endif
+};
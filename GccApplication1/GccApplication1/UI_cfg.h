@@ -0,0 +1,36 @@
+/*
+ * UI_cfg.h
+ *
+ * Created: 19-Oct-26
+ *  Author: diaag
+ */ 
+
+
+#ifndef UI_CFG_H_
+#define UI_CFG_H_
+
+#include "UI.h"
+#include "MCAL/ICU/Icu_Cfg.h"
+
+/* Widgets of the screen, index into UI_WidgetConfig */
+#define UI_WIDGET_PWM_LABEL		(0u)
+#define UI_WIDGET_DUTY_LABEL	(1u)
+#define UI_WIDGET_DUTY			(2u)	/* "100.0%" in Font_Digits16 */
+#define UI_WIDGET_FREQ			(3u)	/* "Frequency = 31.25KHZ" */
+#define UI_WIDGET_PLOT			(4u)
+#define UI_WIDGET_DUTY_BAR		(5u)	/* Duty 0..0x8000 next to the number */
+#if ICU_USED
+#define UI_WIDGET_MEAS			(6u)	/* "Meas 31.25KHZ  50.0%" */
+#define UI_NUM_WIDGETS			(7u)
+#else
+#define UI_NUM_WIDGETS			(6u)
+#endif
+
+/* Text lengths of the text widgets, NUL excluded */
+#define UI_DUTY_CHARS			(6u)
+#define UI_LINE_CHARS			(21u)
+
+extern const UI_WidgetConfigType UI_WidgetConfig[UI_NUM_WIDGETS];
+
+
+#endif /* UI_CFG_H_ */
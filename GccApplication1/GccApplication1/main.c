@@ -8,111 +8,133 @@
 
 
 #include <avr/interrupt.h>
+#include <avr/pgmspace.h>
+#include <stdlib.h>
+#include <string.h>
 #include <time.h>
 #ifndef F_CPU
 #define F_CPU 8000000UL
 #endif
 #include <util/delay.h>
 
-#define ADC_CHANNEL 0
-
 #include "GLCD.h"
+#include "GLCD_Gray.h"
+#include "UI.h"
+#include "UI_cfg.h"
 #include "MCAL/DIO/Dio.h"
-
-void ADC_Init() {
-	// Configure reference voltage and enable ADC
-	Dio_InitChannel(1,DIO_INPUT);
-	Dio_InitChannel(2,DIO_INPUT);
-	ADMUX = (1 << REFS0);  // AVCC as reference voltage
-    ADCSRA = (1 << ADEN) | (1 << ADPS2) | (1 << ADPS1) | (1 << ADPS0);
-}
-
-uint16_t ADC_Read(uint8_t channel) {
-	// Select ADC channel
-	ADMUX = (ADMUX & 0xF0) | (channel & 0x0F);
-    //ADMUX = (1 << REFS0);
-
-	// Start ADC conversion
-	ADCSRA |= (1 << ADSC);
-
-	// Wait for conversion to complete
-	while (ADCSRA & (1 << ADSC));
-
-	// Return ADC result
-	return ADC;
-}
-
+#include "MCAL/ADC/Adc.h"
+#include "MCAL/PWM/Pwm.h"
+#include "MCAL/PWM/Pwm_Cfg.h"
+#include "MCAL/ICU/Icu.h"
+#include "MCAL/ICU/Icu_Cfg.h"
+#include "LIB/FXP/Fxp.h"
+#include "LIB/FMT/Fmt.h"
 
 int main(void)
 {
 	GLCD_Init();
-	ADC_Init();
+	Adc_Init();
+	Pwm_Init(&Pwm_Config);
+#if ICU_USED
+	Icu_Init();
+#endif
+	sei();
 	GLCD_ClearAll();
-	Print_String("PWM Signal ", 1);
+#if GLCD_GRAY_USED && GLCD_GRAY_BENCH
+	{
+		/* Full-band gray flush time and the frame rate it sustains, shown for 5 s */
+		GLCD_GrayBenchType bench;
+		char line[22];
+
+		GLCD_Gray_Bench(&bench);
+		GLCD_Gray_Lock();
+		GLCD_LoadTemplate_P(line, PSTR("Flush now       us"), sizeof(line));
+		Fmt_U32(&line[10], 5, bench.FlushUs, ' ');
+		GLCD_PrintText(line, 18, 0, 0);
+		GLCD_LoadTemplate_P(line, PSTR(" 8MHz       us     Hz"), sizeof(line));
+		Fmt_U32(&line[6], 5, bench.FlushUs8, ' ');
+		Fmt_U32(&line[15], 4, bench.FrameHz8, ' ');
+		GLCD_PrintText(line, 21, 1, 0);
+		GLCD_LoadTemplate_P(line, PSTR("16MHz       us     Hz"), sizeof(line));
+		Fmt_U32(&line[6], 5, bench.FlushUs16, ' ');
+		Fmt_U32(&line[15], 4, bench.FrameHz16, ' ');
+		GLCD_PrintText(line, 21, 2, 0);
+		GLCD_Gray_Unlock();
+		_delay_ms(5000);
+		/* The band overlaps the plot, the UI below owns the whole screen */
+		GLCD_Gray_Stop();
+		GLCD_ClearAll();
+	}
+#endif
+#if GLCD_BENCH
+	{
+		/* Landscape vs portrait row write times, shown for 5 s */
+		GLCD_BenchType bench;
+		char line[22];
+
+		GLCD_Bench(&bench);
+		GLCD_ClearAll();
+		GLCD_LoadTemplate_P(line, PSTR("     Land   Port"), sizeof(line));
+		GLCD_PrintText(line, 16, 0, 0);
+		GLCD_LoadTemplate_P(line, PSTR("Full      us      us"), sizeof(line));
+		Fmt_U32(&line[4], 6, bench.LandscapeUs, ' ');
+		Fmt_U32(&line[12], 6, bench.PortraitUs, ' ');
+		GLCD_PrintText(line, 20, 1, 0);
+		GLCD_LoadTemplate_P(line, PSTR("Part      us      us"), sizeof(line));
+		Fmt_U32(&line[4], 6, bench.LandscapePartUs, ' ');
+		Fmt_U32(&line[12], 6, bench.PortraitPartUs, ' ');
+		GLCD_PrintText(line, 20, 2, 0);
+		_delay_ms(5000);
+		GLCD_ClearAll();
+	}
+#endif
+	/* Screen layout and labels are the widget table of UI_cfg.c */
+	UI_Init();
 
 	int pwmvalue = 0;
 	int timefactor = 10; //min:2 max: 25
-	char duty[] = "Duty Cycle = 000 %";
-	char freq[] = "Frequency = 320 KHZ";
+	uint16_t dutyCycle = 0;
+	char duty[UI_DUTY_CHARS + 1];
+	char freq[UI_LINE_CHARS + 1];
 	uint16_t adcValue;
+#if ICU_USED
+	char meas[UI_LINE_CHARS + 1];
+	Icu_MeasurementType measurement;
+#endif
+
+	/* Line templates live in flash, only the working copies take SRAM */
+	GLCD_LoadTemplate_P(duty, PSTR("  0.0%"), sizeof(duty));
+	GLCD_LoadTemplate_P(freq, PSTR("Frequency = ---------"), sizeof(freq));
+#if ICU_USED
+	GLCD_LoadTemplate_P(meas, PSTR("Meas --------- ---.-%"), sizeof(meas));
+#endif
+
+	/* Frequency of the real OC2 output, from the configured prescaler and TOP */
+	Fmt_Frequency(&freq[12], 9, Pwm_GetFrequency(PWM_TIMER2) * 10u);
+	UI_SetText(UI_WIDGET_FREQ, freq);
 
 	while (1)
 	{
-		SELECTFIRST();
-		GLCD_Command(0x40);        /* Set Y address (column=0) */
-		GLCD_Command(0xB8 + 2);     /* Set x address (page=0) */
-
-		int dc = pwmvalue * 100 / 256;
-		if (dc == 100){
-			duty[13] = '1';
-			duty[14] = '0';
-			duty[15] = '0';
-			}
-			else {
-		duty[13] = '0';	
-		duty[14] = dc/10+'0';
-		duty[15] = dc%10+'0';
-}
-		Print_String(duty, 2);
-		Print_String(freq, 3);
-
-		SELECTFIRST();
-		GLCD_Command(0x40);        /* Set Y address (column=0) */
-		GLCD_Command(0xB8 + 5);
-
-		int x = pwmvalue / timefactor;
-		int nextk = 256 / timefactor;
-		int k = 0;
-
-		for (int i = 0; i < 128; i++)
-		{
-			if (i == 64)
-			{
-				SELECTSECOND();
-				GLCD_Command(0x40); /* Set Y address (column=0) */
-				GLCD_Command(0xB8 + 5);
-			}
-
-			if (i == nextk || i == x + k)
-			{
-				GLCD_Data(CHANGEVOLT);
-				if (i == nextk)
-				{
-					k = nextk;
-					nextk = 256 / timefactor + i;
-				}
-			}
-			else if (i > x + k)
-			{
-				GLCD_Data(LOWVOLT);
-			}
-			else
-			{
-				GLCD_Data(HIGHVOLT);
-			}
-		}
-		adcValue = ADC_Read(ADC_CHANNEL)*(256.0/1023.0);
-		pwmvalue = adcValue;
+		Fmt_DutyPercent(duty, 5, dutyCycle, 1);
+		UI_SetText(UI_WIDGET_DUTY, duty);
+		UI_SetValue(UI_WIDGET_DUTY_BAR, dutyCycle);
+
+#if ICU_USED
+		/* What is actually on the wire, measured on ICP1 */
+		Icu_GetMeasurement(&measurement);
+		Fmt_Frequency(&meas[5], 9, measurement.FrequencyDeciHz);
+		Fmt_DutyPercent(&meas[15], 5, measurement.DutyCycle, 1);
+		UI_SetText(UI_WIDGET_MEAS, meas);
+#endif
+
+		UI_SetPlot(UI_WIDGET_PLOT, 256 / timefactor, pwmvalue / timefactor);
+		/* Only the widgets (and text cells) that changed since the last frame are sent */
+		UI_Update();
+
+		adcValue = Adc_GetLatest();
+		pwmvalue = Fxp_Adc10ToN(adcValue, 8);	/* 0..1023 -> 0..256 */
+		dutyCycle = Fxp_Adc10ToDuty(adcValue);
+		Pwm_SetDutyCycle(PwmConf_PwmChannel_Signal, dutyCycle);
 
 		_delay_ms(10);
 	}
@@ -0,0 +1,81 @@
+/*
+ * GfxBench.c
+ *
+ * Created: 19-Oct-26
+ *  Author: diaag
+ *
+ * Host benchmark of the GLCD_Gfx primitives drawing into a RAM band, the
+ * code path that runs on the target minus the bus transfer. The GLCD bus
+ * calls are stubbed. Build and run from this directory with any C compiler:
+ *
+ *   gcc -O2 -I../../GccApplication1/GccApplication1 GfxBench.c \
+ *       ../../GccApplication1/GccApplication1/GLCD_Gfx.c \
+ *       ../../GccApplication1/GccApplication1/LIB/BIT/Bit.c -o GfxBench
+ *   ./GfxBench
+ *
+ * The figures compare primitives against each other and against earlier
+ * runs; scale by the host/AVR clock and cycles-per-operation ratio for an
+ * estimate on the ATmega32.
+ */ 
+
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "GLCD.h"
+#include "GLCD_Fb.h"
+#include "GLCD_Gfx.h"
+
+/* Bus and framebuffer stubs, the benchmark only draws into its own band */
+uint8_t GLCD_Orientation = GLCD_LANDSCAPE;
+uint8_t GLCD_Fb[GLCD_FB_PAGES][128];
+void GLCD_Fb_MarkDirty(uint8_t page, uint8_t x0, uint8_t x1) { (void)page; (void)x0; (void)x1; }
+void GLCD_WriteRow(uint8_t page, uint8_t col, const uint8_t* data, uint8_t len) { (void)page; (void)col; (void)data; (void)len; }
+void GLCD_ReadRow(uint8_t page, uint8_t col, uint8_t* data, uint8_t len) { (void)page; (void)col; (void)data; (void)len; }
+
+static uint8_t Band[8][128];
+static volatile uint8_t Sink;
+
+typedef void (*BenchFn)(uint32_t i);
+
+static void BenchPixel(uint32_t i)    { GLCD_Gfx_Pixel(i & 127, (i >> 7) & 63, GLCD_PIXEL_XOR); }
+static void BenchHLine(uint32_t i)    { GLCD_Gfx_HLine(0, 127, i & 63, GLCD_PIXEL_XOR); }
+static void BenchVLine(uint32_t i)    { GLCD_Gfx_VLine(i & 127, 0, 63, GLCD_PIXEL_XOR); }
+static void BenchLine(uint32_t i)     { GLCD_Gfx_Line(0, i & 63, 127, 63 - (i & 63), GLCD_PIXEL_XOR); }
+static void BenchRect(uint32_t i)     { GLCD_Gfx_Rect(i & 31, i & 15, 127 - (i & 31), 63 - (i & 15), GLCD_PIXEL_XOR); }
+static void BenchFillRect(uint32_t i) { GLCD_Gfx_FillRect(i & 31, i & 15, 127 - (i & 31), 63 - (i & 15), GLCD_PIXEL_XOR); }
+static void BenchCircle(uint32_t i)   { GLCD_Gfx_Circle(64, 32, 4 + (i & 27), GLCD_PIXEL_XOR); }
+
+static void Run(const char* name, BenchFn fn)
+{
+	uint32_t n = 0, batch = 1000;
+	clock_t start = clock(), now;
+	double seconds;
+
+	do {
+		uint32_t k;
+		for (k = 0; k < batch; k++) {
+			fn(n + k);
+		}
+		n += batch;
+		now = clock();
+	} while (now - start < CLOCKS_PER_SEC / 2);
+
+	seconds = (double)(now - start) / CLOCKS_PER_SEC;
+	Sink ^= Band[n & 7][n & 127];
+	printf("%-10s %12.0f /s %10.1f ns\n", name, n / seconds, seconds * 1e9 / n);
+}
+
+int main(void)
+{
+	GLCD_Gfx_UseBand(&Band[0][0], 0, 8);
+
+	Run("Pixel", BenchPixel);
+	Run("HLine", BenchHLine);
+	Run("VLine", BenchVLine);
+	Run("Line", BenchLine);
+	Run("Rect", BenchRect);
+	Run("FillRect", BenchFillRect);
+	Run("Circle", BenchCircle);
+	return 0;
+}
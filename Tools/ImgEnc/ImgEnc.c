@@ -0,0 +1,302 @@
+/*
+ * ImgEnc.c
+ *
+ * Created: 19-Oct-26
+ *  Author: diaag
+ *
+ * Host encoder for GLCD_DrawImage: reads a PBM image (P1 or P4, up to
+ * 128 x 64, black pixels are set) and writes a C array in the compressed
+ * page-major format of GLCD_Image.h. A PGM image (P2 or P5, 8 or 16 bit)
+ * is dithered to 1 bit first, with the 4x4 Bayer matrix of GLCD_Dither.h
+ * (-bayer, the same pattern GLCD_Dither draws on the target) or with
+ * Floyd-Steinberg error diffusion (-fs, the default), both in integers. The rows are turned into page-major
+ * columns with the 8x8 transpose of LIB/BIT, the same code the target uses.
+ * The output is decoded again and compared before it is written. Build and
+ * run from this directory with any C compiler:
+ *
+ *   gcc -O2 -I../../GccApplication1/GccApplication1 ImgEnc.c \
+ *       ../../GccApplication1/GccApplication1/LIB/BIT/Bit.c -o ImgEnc
+ *   ./ImgEnc splash.pbm Image_Splash > Image_Splash.c
+ *   ./ImgEnc -bayer photo.pgm Image_Photo > Image_Photo.c
+ */ 
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "LIB/BIT/Bit.h"
+#include "GLCD_Dither.h"
+
+#define MAX_W		(128)
+#define MAX_PAGES	(8)
+#define WINDOW		(128)	/* GLCD_IMAGE_WINDOW */
+#define MIN_MATCH	(3)
+#define MAX_MATCH	(66)
+#define MAX_LITERAL	(128)
+
+/* Dither of a grayscale input */
+#define DITHER_FS		(0)
+#define DITHER_BAYER	(1)
+
+static uint8_t Rows[MAX_PAGES * 8][MAX_W / 8];	/* Packed rows, leftmost pixel in bit 7 */
+static uint8_t Raw[MAX_PAGES * MAX_W];
+static uint8_t Out[MAX_PAGES * MAX_W * 2];
+static uint8_t Dark[MAX_PAGES * 8][MAX_W];	/* Grayscale input as darkness, 255 = black */
+
+/* Next header or raster token of a PBM, '#' comments skipped */
+static int PbmToken(FILE* f)
+{
+	int c, v = 0, digits = 0;
+
+	while ((c = fgetc(f)) != EOF) {
+		if (c == '#') {
+			while ((c = fgetc(f)) != EOF && c != '\n');
+		} else if (c >= '0' && c <= '9') {
+			break;
+		}
+	}
+	while (c >= '0' && c <= '9') {
+		v = v * 10 + (c - '0');
+		digits++;
+		c = fgetc(f);
+	}
+	return digits ? v : -1;
+}
+
+/* Sets pixel x of packed row y */
+static void SetPixel(int x, int y)
+{
+	Rows[y][x / 8] |= (uint8_t)(0x80 >> (x & 7));
+}
+
+/* Darkness 0..255 of the PGM sample v of 0..maxval, 0 is black */
+static uint8_t Darkness(int v, int maxval)
+{
+	return (uint8_t)(255 - (v * 255 + maxval / 2) / maxval);
+}
+
+static void DitherBayer(int w, int h)
+{
+	static const uint8_t Bayer[4][4] = GLCD_DITHER_BAYER4;
+	int x, y;
+
+	for (y = 0; y < h; y++) {
+		for (x = 0; x < w; x++) {
+			if (Bayer[y & 3][x & 3] < GLCD_DITHER_LEVEL(Dark[y][x])) {
+				SetPixel(x, y);
+			}
+		}
+	}
+}
+
+/* Floyd-Steinberg, errors in 1/16 units carried in two rows, serpentine scan */
+static void DitherFs(int w, int h)
+{
+	static int Err[2][MAX_W + 2];
+	int x, y, i, dir, v, e;
+	int* cur;
+	int* next;
+
+	memset(Err, 0, sizeof(Err));
+	for (y = 0; y < h; y++) {
+		cur = Err[y & 1];
+		next = Err[(y + 1) & 1];
+		memset(next, 0, sizeof(Err[0]));
+		dir = (y & 1) ? -1 : 1;
+		for (i = 0; i < w; i++) {
+			x = (dir > 0) ? i : w - 1 - i;
+			v = Dark[y][x] + cur[x + 1] / 16;
+			if (v >= 128) {
+				SetPixel(x, y);
+				e = v - 255;
+			} else {
+				e = v;
+			}
+			cur[x + 1 + dir] += e * 7;
+			next[x + 1 - dir] += e * 3;
+			next[x + 1] += e * 5;
+			next[x + 1 + dir] += e * 1;
+		}
+	}
+}
+
+static int ReadImage(const char* path, int dither, int* w, int* h)
+{
+	FILE* f = fopen(path, "rb");
+	int binary, gray, maxval = 1, x, y, c, bit, v;
+
+	if (f == NULL) {
+		perror(path);
+		return 0;
+	}
+	if (fgetc(f) != 'P' || (c = fgetc(f)) < '1' || c > '5' || c == '3') {
+		fprintf(stderr, "%s: not a PBM or PGM file\n", path);
+		fclose(f);
+		return 0;
+	}
+	binary = (c == '4' || c == '5');
+	gray = (c == '2' || c == '5');
+	*w = PbmToken(f);
+	*h = PbmToken(f);
+	if (gray) {
+		maxval = PbmToken(f);
+	}
+	if (*w <= 0 || *h <= 0 || *w > MAX_W || *h > MAX_PAGES * 8 || maxval <= 0 || maxval > 65535) {
+		fprintf(stderr, "%s: size must be 1..128 x 1..64\n", path);
+		fclose(f);
+		return 0;
+	}
+	for (y = 0; y < *h; y++) {
+		if (gray) {
+			for (x = 0; x < *w; x++) {
+				if (!binary) {
+					v = PbmToken(f);
+				} else if (maxval > 255) {
+					v = fgetc(f) << 8;
+					v |= fgetc(f);
+				} else {
+					v = fgetc(f);
+				}
+				Dark[y][x] = Darkness(v < 0 ? 0 : v, maxval);
+			}
+		} else if (binary) {
+			for (x = 0; x < (*w + 7) / 8; x++) {
+				Rows[y][x] = (uint8_t)fgetc(f);
+			}
+			/* Padding bits of the last byte are not part of the image */
+			if (*w & 7) {
+				Rows[y][(*w - 1) / 8] &= (uint8_t)(0xFF << (8 - (*w & 7)));
+			}
+		} else {
+			for (x = 0; x < *w; x++) {
+				bit = (PbmToken(f) == 1);
+				Rows[y][x / 8] |= (uint8_t)(bit << (7 - (x & 7)));
+			}
+		}
+	}
+	fclose(f);
+	if (gray) {
+		if (dither == DITHER_BAYER) {
+			DitherBayer(*w, *h);
+		} else {
+			DitherFs(*w, *h);
+		}
+	}
+	return 1;
+}
+
+static int Encode(const uint8_t* raw, int n)
+{
+	int pos = 0, out = 0, lit = -1, run, best, bestDist, d, len;
+
+	while (pos < n) {
+		for (run = 1; pos + run < n && run < MAX_MATCH && raw[pos + run] == raw[pos]; run++);
+		best = 0;
+		bestDist = 0;
+		for (d = 1; d <= WINDOW && d <= pos; d++) {
+			for (len = 0; pos + len < n && len < MAX_MATCH && raw[pos + len] == raw[pos + len - d]; len++);
+			if (len > best) {
+				best = len;
+				bestDist = d;
+			}
+		}
+		if (run >= MIN_MATCH && run >= best) {
+			Out[out++] = (uint8_t)(0x80 | (run - 3));
+			Out[out++] = raw[pos];
+			pos += run;
+			lit = -1;
+		} else if (best >= MIN_MATCH) {
+			Out[out++] = (uint8_t)(0xC0 | (best - 3));
+			Out[out++] = (uint8_t)(bestDist - 1);
+			pos += best;
+			lit = -1;
+		} else {
+			if (lit < 0 || Out[lit] == MAX_LITERAL - 1) {
+				lit = out;
+				Out[out++] = 0xFF;	/* Count, fixed below */
+			}
+			Out[lit] = (uint8_t)(Out[lit] + 1);
+			Out[out++] = raw[pos++];
+		}
+	}
+	return out;
+}
+
+/* Reference decoder, same token rules as GLCD_Image.c */
+static int Check(const uint8_t* raw, int n, int size)
+{
+	static uint8_t dec[MAX_PAGES * MAX_W];
+	int in = 0, pos = 0, count, i, d;
+	uint8_t t;
+
+	while (pos < n && in < size) {
+		t = Out[in++];
+		if (t < 0x80) {
+			for (i = 0; i <= t; i++) dec[pos++] = Out[in++];
+		} else if (t < 0xC0) {
+			count = (t & 0x3F) + 3;
+			for (i = 0; i < count; i++) dec[pos++] = Out[in];
+			in++;
+		} else {
+			count = (t & 0x3F) + 3;
+			d = Out[in++] + 1;
+			for (i = 0; i < count; i++, pos++) dec[pos] = dec[pos - d];
+		}
+	}
+	return pos == n && in == size && memcmp(dec, raw, n) == 0;
+}
+
+int main(int argc, char** argv)
+{
+	int w, h, pages, p, x, bx, r, n, size, i;
+	int dither = DITHER_FS;
+	uint8_t rows[8], block[8];
+
+	if (argc == 4 && strcmp(argv[1], "-bayer") == 0) {
+		dither = DITHER_BAYER;
+		argv++;
+		argc--;
+	} else if (argc == 4 && strcmp(argv[1], "-fs") == 0) {
+		argv++;
+		argc--;
+	}
+	if (argc != 3) {
+		fprintf(stderr, "usage: %s [-bayer | -fs] image.pbm|image.pgm ArrayName > ArrayName.c\n", argv[0]);
+		return 2;
+	}
+	if (!ReadImage(argv[1], dither, &w, &h)) {
+		return 1;
+	}
+
+	/* Page-major column bytes, bit 0 is the top row of a page */
+	pages = (h + 7) / 8;
+	n = 0;
+	for (p = 0; p < pages; p++) {
+		for (bx = 0; bx * 8 < w; bx++) {
+			for (r = 0; r < 8; r++) {
+				rows[r] = (p * 8 + r < h) ? Rows[p * 8 + r][bx] : 0x00;
+			}
+			Bit_Transpose8x8(rows, block);
+			for (x = 0; x < 8 && bx * 8 + x < w; x++) {
+				Raw[n++] = block[7 - x];	/* Leftmost pixel is bit 7 */
+			}
+		}
+	}
+
+	size = Encode(Raw, n);
+	if (!Check(Raw, n, size)) {
+		fprintf(stderr, "%s: decode check failed\n", argv[1]);
+		return 1;
+	}
+
+	printf("/* %s: %d x %d, %d bytes raw, %d bytes coded, generated by Tools/ImgEnc */\n\n", argv[1], w, h, n, size + 2);
+	printf("#include <stdint.h>\n#include <avr/pgmspace.h>\n\n");
+	printf("const uint8_t %s[] PROGMEM = {\n\t%d, %d,", argv[2], w, pages);
+	for (i = 0; i < size; i++) {
+		printf("%s0x%02X,", (i % 16) ? " " : "\n\t", Out[i]);
+	}
+	printf("\n};\n");
+	fprintf(stderr, "%s: %d bytes raw, %d bytes coded\n", argv[1], n, size + 2);
+	return 0;
+}